@@ -0,0 +1,68 @@
+/*
+    SerialNumber Table Benchmark
+
+    This example compares the run time of the arithmetic comparison kernels
+    with the table-based kernels for SerialNumber<uint8_t>.
+    https://github.com/agrommek/SerialNumber
+
+    Define SERIALNUMBER_UINT8_TABLE before including SerialNumber.h to make
+    the comparison operators for SerialNumber<uint8_t> use the tables.
+
+    This example code is in the public domain.
+
+    SerialNumber contributors
+    2026-10-16
+*/
+
+#include <SerialNumber.h>
+
+// volatile sink, prevents the compiler from optimizing the loops away
+volatile uint8_t sink = 0;
+
+// time all 256 x 256 comparisons with the arithmetic kernels
+unsigned long time_arithmetic() {
+    uint8_t count = 0;
+    unsigned long start = micros();
+    for (uint16_t i=0; i<=255; i++) {
+        for (uint16_t j=0; j<=255; j++) {
+            count += serialnumber_less<uint8_t>(i, j);
+            count += serialnumber_greater<uint8_t>(i, j);
+        }
+    }
+    unsigned long stop = micros();
+    sink = count;
+    return stop - start;
+}
+
+// time all 256 x 256 comparisons with the table-based kernels
+unsigned long time_table() {
+    uint8_t count = 0;
+    unsigned long start = micros();
+    for (uint16_t i=0; i<=255; i++) {
+        for (uint16_t j=0; j<=255; j++) {
+            count += serialnumber_less_table(i, j);
+            count += serialnumber_greater_table(i, j);
+        }
+    }
+    unsigned long stop = micros();
+    sink = count;
+    return stop - start;
+}
+
+void setup() {
+    Serial.begin(115200);
+
+    Serial.println(F("Timing 2 x 65536 comparisons of SerialNumber<uint8_t>..."));
+
+    Serial.print(F("arithmetic: "));
+    Serial.print(time_arithmetic());
+    Serial.println(F(" us"));
+
+    Serial.print(F("table:      "));
+    Serial.print(time_table());
+    Serial.println(F(" us"));
+}
+
+void loop() {
+    // nothing to to
+}
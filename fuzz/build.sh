@@ -0,0 +1,77 @@
+#!/bin/sh
+#
+# Build (and optionally run) the fuzz targets.
+#
+# With clang and libFuzzer, the targets are built with 
+# -fsanitize=fuzzer,address,undefined. Otherwise (e.g. GCC only), they are
+# built with standalone_main.cpp and AddressSanitizer/UBSan, which runs
+# the seed corpus and a number of pseudo-random inputs.
+#
+# fuzz_compare_table is fuzz_compare built with SERIALNUMBER_UINT8_TABLE,
+# so that the operators of SerialNumber<uint8_t> use the lookup tables.
+#
+# Usage: fuzz/build.sh [run [seconds]]
+#
+#   CXX     compiler for the standalone build (default c++)
+#   CLANGXX compiler for the libFuzzer build (default clang++)
+#   OUT     output directory (default fuzz/build)
+
+DIR=$(cd "$(dirname "$0")" && pwd)
+SRC="$DIR/../src"
+OUT=${OUT:-"$DIR/build"}
+CXX=${CXX:-c++}
+CLANGXX=${CLANGXX:-clang++}
+TARGETS="fuzz_compare fuzz_compare_table fuzz_codec fuzz_batch"
+FLAGS="-std=gnu++11 -g -O1 -I$SRC -I$DIR -fno-sanitize-recover=all"
+
+# source file, extra flags and seed corpus of a target
+source_of() {
+    case "$1" in
+        fuzz_compare_table) echo fuzz_compare ;;
+        *) echo "$1" ;;
+    esac
+}
+flags_of() {
+    case "$1" in
+        fuzz_compare_table) echo -DSERIALNUMBER_UINT8_TABLE ;;
+    esac
+}
+corpus_of() {
+    src=$(source_of "$1")
+    echo "$DIR/corpus/${src#fuzz_}"
+}
+
+mkdir -p "$OUT" || exit 1
+
+# libFuzzer available?
+echo 'extern "C" int LLVMFuzzerTestOneInput(const unsigned char*, unsigned long) { return 0; }' > "$OUT/probe.cpp"
+if $CLANGXX -fsanitize=fuzzer "$OUT/probe.cpp" -o "$OUT/probe" > /dev/null 2>&1; then
+    MODE=libfuzzer
+else
+    MODE=standalone
+fi
+rm -f "$OUT/probe.cpp" "$OUT/probe"
+echo "building $MODE fuzz targets in $OUT"
+
+for t in $TARGETS; do
+    src="$DIR/$(source_of "$t").cpp"
+    if [ "$MODE" = libfuzzer ]; then
+        $CLANGXX $FLAGS $(flags_of "$t") -fsanitize=fuzzer,address,undefined "$src" -o "$OUT/$t" || exit 1
+    else
+        $CXX $FLAGS $(flags_of "$t") -fsanitize=address,undefined "$src" "$DIR/standalone_main.cpp" -o "$OUT/$t" || exit 1
+    fi
+done
+
+[ "$1" = run ] || exit 0
+SECONDS_PER_TARGET=${2:-60}
+
+for t in $TARGETS; do
+    corpus=$(corpus_of "$t")
+    if [ "$MODE" = libfuzzer ]; then
+        # new inputs go to a scratch directory, the seed corpus stays unchanged
+        mkdir -p "$OUT/corpus_$t"
+        "$OUT/$t" -max_total_time="$SECONDS_PER_TARGET" "$OUT/corpus_$t" "$corpus" || exit 1
+    else
+        "$OUT/$t" -random=200000 "$corpus" || exit 1
+    fi
+done
@@ -0,0 +1,176 @@
+/*
+Fuzz target for the batch kernels: ZoneSerialTracker::evaluate() and 
+notify() for lists of zones, and compare()/merge() of SerialVersionVector
+and SparseSerialVersionVector, all checked against the reference 
+implementation.
+
+Input layout (little endian, missing bytes read as zero):
+
+    1 byte       width: 0 = uint8_t, 1 = uint16_t, 2 = uint32_t, 3 = uint64_t
+    1 byte       n (modulo 65), number of zones
+    n*sizeof(T)  local serials
+    n*sizeof(T)  incoming serials
+    n bytes      initial pending flags (lowest bit)
+    n bytes      zone list for notify() (modulo n)
+    2 bytes      presence masks of two version vectors (16 entries each,
+                 one bit per pair of entries)
+    16*sizeof(T) entries of the first vector
+    16*sizeof(T) entries of the second vector
+*/
+
+#include <map>
+#include "fuzz_common.h"
+#include "ZoneSerialTracker.h"
+#include "SerialVersionVector.h"
+
+static const size_t VV = 16;
+
+template <class T>
+static void check_zones(FuzzInput& in) {
+    const size_t n = in.byte() % 65;
+    T local[64];
+    T remote[64];
+    uint8_t pending[64];
+    size_t list[64];
+    for (size_t i=0; i<n; i++) local[i] = in.value<T>();
+    for (size_t i=0; i<n; i++) remote[i] = in.value<T>();
+    for (size_t i=0; i<n; i++) pending[i] = in.byte() & 1;
+    for (size_t i=0; i<n; i++) list[i] = (n > 0) ? (in.byte() % n) : 0;
+
+    // contiguous block
+    T s1[64];
+    uint8_t p1[64];
+    size_t expected = 0;
+    for (size_t i=0; i<n; i++) {
+        s1[i] = local[i];
+        p1[i] = pending[i];
+        expected += (pending[i] || ref_greater(remote[i], local[i]));
+    }
+    ZoneSerialTracker<T> block(s1, p1, n);
+    FUZZ_CHECK(block.evaluate(0, remote, n) == expected);
+    for (size_t i=0; i<n; i++) {
+        FUZZ_CHECK(block.pending(i) == (pending[i] || ref_greater(remote[i], local[i])));
+        FUZZ_CHECK(s1[i] == local[i]);
+    }
+
+    // list of zones, possibly with repetitions
+    T s2[64];
+    uint8_t p2[64];
+    uint8_t ref[64];
+    for (size_t i=0; i<n; i++) {
+        s2[i] = local[i];
+        p2[i] = pending[i];
+        ref[i] = pending[i];
+    }
+    expected = 0;
+    for (size_t i=0; i<n; i++) {
+        const size_t z = list[i];
+        ref[z] = ref[z] || ref_greater(remote[i], local[z]);
+        expected += ref[z];
+    }
+    ZoneSerialTracker<T> zones(s2, p2, n);
+    FUZZ_CHECK(zones.notify(list, remote, n) == expected);
+    for (size_t i=0; i<n; i++) FUZZ_CHECK(zones.pending(i) == (ref[i] != 0));
+}
+
+typedef std::map<size_t, fuzz_wide> RefVector;
+
+// absent entries are lower than present ones, critical distance is a tie
+template <class T>
+static SerialVersionOrder ref_order(const RefVector& a, const RefVector& b) {
+    bool lower = false;
+    bool greater = false;
+    bool tie = false;
+    for (size_t i=0; i<VV; i++) {
+        const bool pa = a.count(i) > 0;
+        const bool pb = b.count(i) > 0;
+        if (pa && pb) {
+            const T x = static_cast<T>(a.at(i));
+            const T y = static_cast<T>(b.at(i));
+            lower = lower || ref_less(x, y);
+            greater = greater || ref_greater(x, y);
+            tie = tie || ref_tie(x, y);
+        }
+        else if (pa) greater = true;
+        else if (pb) lower = true;
+    }
+    if (tie || (lower && greater)) return SerialVersionOrder::concurrent;
+    if (lower) return SerialVersionOrder::before;
+    if (greater) return SerialVersionOrder::after;
+    return SerialVersionOrder::equal;
+}
+
+// one-sided entries are copied, ties keep the first entry
+template <class T>
+static RefVector ref_merge(RefVector a, const RefVector& b) {
+    for (RefVector::const_iterator it=b.begin(); it!=b.end(); ++it) {
+        RefVector::iterator mine = a.find(it->first);
+        if (mine == a.end()) a[it->first] = it->second;
+        else if (ref_less(static_cast<T>(mine->second), static_cast<T>(it->second))) mine->second = it->second;
+    }
+    return a;
+}
+
+template <class T>
+static void check_vectors(FuzzInput& in) {
+    const uint8_t ma = in.byte();
+    const uint8_t mb = in.byte();
+    RefVector ra;
+    RefVector rb;
+    SerialVersionVector<T, VV> da;
+    SerialVersionVector<T, VV> db;
+    SparseSerialVersionVector<T, VV, uint8_t> sa;
+    SparseSerialVersionVector<T, VV, uint8_t> sb;
+    for (size_t i=0; i<VV; i++) {
+        const T v = in.value<T>();
+        if (ma & (1u << (i / 2))) {
+            ra[i] = v;
+            da.set(i, SerialNumber<T>{v});
+            FUZZ_CHECK(sa.set(static_cast<uint8_t>(i), SerialNumber<T>{v}));
+        }
+    }
+    for (size_t i=0; i<VV; i++) {
+        const T v = in.value<T>();
+        if (mb & (1u << (i / 2))) {
+            rb[i] = v;
+            db.set(i, SerialNumber<T>{v});
+            FUZZ_CHECK(sb.set(static_cast<uint8_t>(i), SerialNumber<T>{v}));
+        }
+    }
+
+    const SerialVersionOrder order = ref_order<T>(ra, rb);
+    FUZZ_CHECK(da.compare(db) == order);
+    FUZZ_CHECK(sa.compare(sb) == order);
+    FUZZ_CHECK((da == db) == (order == SerialVersionOrder::equal));
+    FUZZ_CHECK((sa == sb) == (order == SerialVersionOrder::equal));
+
+    const RefVector rm = ref_merge<T>(ra, rb);
+    da.merge(db);
+    FUZZ_CHECK(sa.merge(sb));
+    FUZZ_CHECK(sa.size() == rm.size());
+    for (size_t i=0; i<VV; i++) {
+        const bool present = rm.count(i) > 0;
+        const T v = present ? static_cast<T>(rm.at(i)) : 0;
+        FUZZ_CHECK(da.contains(i) == present);
+        FUZZ_CHECK(sa.contains(static_cast<uint8_t>(i)) == present);
+        FUZZ_CHECK(da.get(i).value() == v);
+        FUZZ_CHECK(sa.get(static_cast<uint8_t>(i)).value() == v);
+    }
+}
+
+template <class T>
+static void run(FuzzInput& in) {
+    check_zones<T>(in);
+    check_vectors<T>(in);
+}
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size) {
+    FuzzInput in{data, size};
+    switch (in.byte() & 3) {
+        case 0: run<uint8_t>(in); break;
+        case 1: run<uint16_t>(in); break;
+        case 2: run<uint32_t>(in); break;
+        default: run<uint64_t>(in); break;
+    }
+    return 0;
+}
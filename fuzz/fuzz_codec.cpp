@@ -0,0 +1,204 @@
+/*
+Fuzz target for the codecs in SerialNumberCodec.h: zigzag, varint, and 
+list encoding with plain and group varints.
+
+ - Lists of SerialNumbers from the input must survive encoding and 
+   decoding unchanged, including wrap-arounds.
+ - Encoding into a buffer which is too small must fail (return 0) without
+   writing past its end.
+ - Decoding arbitrary bytes must not read past the end of the input. If 
+   decoding succeeds, the input must have been canonical: re-encoding
+   the result gives exactly the bytes which were read. Non-canonical
+   variants of valid encodings (overlong varints, stray high bits, zero
+   high bytes in group varints) must be rejected.
+
+Input layout (little endian, missing bytes read as zero):
+
+    1 byte       width: 0 = uint8_t, 1 = uint16_t, 2 = uint32_t, 3 = uint64_t
+    1 byte       n (modulo 65), number of SerialNumbers
+    1 byte       size of output buffer for the too-small test
+    sizeof(T)    reference
+    n*sizeof(T)  SerialNumbers
+    rest         arbitrary bytes to decode
+*/
+
+#include <string.h>
+#include <vector>
+#include "fuzz_common.h"
+#include "SerialNumberCodec.h"
+
+// group varints exist for types with at most 32 bits
+template <class T, bool G=(sizeof(T) <= 4)>
+struct GroupCodec {
+    static size_t encode(const SerialNumber<T>& r, const SerialNumber<T>* s, size_t n, uint8_t* out, size_t len) {
+        return serialnumber_encode_group(r, s, n, out, len);
+    }
+    static size_t decode(const SerialNumber<T>& r, const uint8_t* in, size_t len, SerialNumber<T>* s, size_t n) {
+        return serialnumber_decode_group(r, in, len, s, n);
+    }
+    static constexpr size_t max_size(size_t n) { return serialnumber_encode_group_max_size<T>(n); }
+    static constexpr bool available = true;
+};
+
+template <class T>
+struct GroupCodec<T, false> {
+    static size_t encode(const SerialNumber<T>&, const SerialNumber<T>*, size_t, uint8_t*, size_t) { return 0; }
+    static size_t decode(const SerialNumber<T>&, const uint8_t*, size_t, SerialNumber<T>*, size_t) { return 0; }
+    static constexpr size_t max_size(size_t) { return 0; }
+    static constexpr bool available = false;
+};
+
+// a copy of data in a buffer of exactly len bytes, so ASan catches overreads
+static std::vector<uint8_t> exact(const uint8_t* data, size_t len) {
+    return std::vector<uint8_t>(data, data + len);
+}
+
+// non-canonical variants of valid encodings must be rejected
+template <class T>
+static void check_noncanonical(const SerialNumber<T>& ref, const SerialNumber<T>* sns, size_t n) {
+    SerialNumber<T> back[64];
+    T value = 0;
+    for (size_t i=0; i<n; i++) {
+        const T zz = serialnumber_zigzag(ref, sns[i]);
+        uint8_t v[varint_max_size<T>() + 1];
+        const size_t vn = varint_encode(zz, v);
+
+        // overlong: continuation bit on the last byte, followed by a zero byte
+        if (vn < varint_max_size<T>()) {
+            std::vector<uint8_t> enc(v, v + vn + 1);
+            enc[vn - 1] = static_cast<uint8_t>(enc[vn - 1] | 0x80);
+            enc[vn] = 0;
+            FUZZ_CHECK(varint_decode(enc.data(), enc.size(), value) == 0);
+        }
+
+        // stray bits beyond the width of T in a varint of maximum length
+        if ((vn == varint_max_size<T>()) && ((sizeof(T) * 8) % 7 != 0)) {
+            std::vector<uint8_t> enc = exact(v, vn);
+            enc[vn - 1] = static_cast<uint8_t>(enc[vn - 1] | 0x40);
+            FUZZ_CHECK(varint_decode(enc.data(), enc.size(), value) == 0);
+        }
+    }
+
+    // group varints: widen the first number by a zero high byte
+    if (GroupCodec<T>::available && (n > 0)) {
+        std::vector<uint8_t> gbuf(GroupCodec<T>::max_size(n));
+        const size_t gused = GroupCodec<T>::encode(ref, sns, n, gbuf.data(), gbuf.size());
+        const uint8_t n0 = static_cast<uint8_t>((gbuf[0] & 0x03) + 1);
+        if (n0 < sizeof(T)) {
+            std::vector<uint8_t> enc(gbuf.begin(), gbuf.begin() + gused);
+            enc[0] = static_cast<uint8_t>(enc[0] + 1);
+            enc.insert(enc.begin() + 1 + n0, 0);
+            FUZZ_CHECK(GroupCodec<T>::decode(ref, enc.data(), enc.size(), back, n) == 0);
+        }
+        // stray bits in the control byte of an incomplete last group
+        if (n % 4 != 0) {
+            std::vector<uint8_t> enc(gbuf.begin(), gbuf.begin() + gused);
+            const size_t last = ((n - 1) / 4) * 4;
+            size_t ctrl = 0;
+            for (size_t g=0; g<last; g+=4) {
+                const uint8_t c = enc[ctrl];
+                ctrl += 1;
+                for (size_t j=0; j<4; j++) ctrl += ((c >> (2 * j)) & 0x03) + 1;
+            }
+            enc[ctrl] = static_cast<uint8_t>(enc[ctrl] | 0xC0);
+            FUZZ_CHECK(GroupCodec<T>::decode(ref, enc.data(), enc.size(), back, n) == 0);
+        }
+    }
+}
+
+template <class T>
+static void check_list(const SerialNumber<T>& ref, const SerialNumber<T>* sns, size_t n, size_t small) {
+    SerialNumber<T> back[64];
+
+    // plain varints
+    std::vector<uint8_t> buf(serialnumber_encode_max_size<T>(n));
+    const size_t used = serialnumber_encode(ref, sns, n, buf.data(), buf.size());
+    FUZZ_CHECK((used > 0) || (n == 0));
+    if (n > 0) {
+        std::vector<uint8_t> enc = exact(buf.data(), used);
+        FUZZ_CHECK(serialnumber_decode(ref, enc.data(), enc.size(), back, n) == used);
+        for (size_t i=0; i<n; i++) FUZZ_CHECK(back[i] == sns[i]);
+        if (small < used) {
+            std::vector<uint8_t> tiny(small);
+            FUZZ_CHECK(serialnumber_encode(ref, sns, n, tiny.data(), tiny.size()) == 0);
+            FUZZ_CHECK(serialnumber_decode(ref, enc.data(), small, back, n) == 0);
+        }
+    }
+
+    // group varints
+    if (GroupCodec<T>::available && (n > 0)) {
+        std::vector<uint8_t> gbuf(GroupCodec<T>::max_size(n));
+        const size_t gused = GroupCodec<T>::encode(ref, sns, n, gbuf.data(), gbuf.size());
+        FUZZ_CHECK(gused > 0);
+        std::vector<uint8_t> enc = exact(gbuf.data(), gused);
+        FUZZ_CHECK(GroupCodec<T>::decode(ref, enc.data(), enc.size(), back, n) == gused);
+        for (size_t i=0; i<n; i++) FUZZ_CHECK(back[i] == sns[i]);
+        if (small < gused) {
+            std::vector<uint8_t> tiny(small);
+            FUZZ_CHECK(GroupCodec<T>::encode(ref, sns, n, tiny.data(), tiny.size()) == 0);
+            FUZZ_CHECK(GroupCodec<T>::decode(ref, enc.data(), small, back, n) == 0);
+        }
+    }
+}
+
+template <class T>
+static void run(FuzzInput& in) {
+    const size_t n = in.byte() % 65;
+    const size_t small = in.byte();
+    const SerialNumber<T> ref{in.value<T>()};
+    SerialNumber<T> sns[64];
+    for (size_t i=0; i<n; i++) sns[i] = in.value<T>();
+
+    // zigzag and varint round trips for each value
+    for (size_t i=0; i<n; i++) {
+        const T zz = serialnumber_zigzag(ref, sns[i]);
+        FUZZ_CHECK(serialnumber_unzigzag(ref, zz) == sns[i]);
+        uint8_t v[varint_max_size<T>()];
+        const size_t vn = varint_encode(zz, v);
+        FUZZ_CHECK((vn >= 1) && (vn <= varint_max_size<T>()));
+        std::vector<uint8_t> enc = exact(v, vn);
+        T back = 0;
+        FUZZ_CHECK(varint_decode(enc.data(), enc.size(), back) == vn);
+        FUZZ_CHECK(back == zz);
+    }
+
+    check_list(ref, sns, n, small);
+
+    check_noncanonical<T>(ref, sns, n);
+
+    // decode arbitrary bytes, whatever decodes successfully must be canonical
+    std::vector<uint8_t> raw = exact(in.rest(), in.rest_size());
+    SerialNumber<T> dec[64];
+    const size_t used = serialnumber_decode(ref, raw.data(), raw.size(), dec, n);
+    if (used > 0) {
+        check_list(ref, dec, n, small);
+        std::vector<uint8_t> again(serialnumber_encode_max_size<T>(n));
+        FUZZ_CHECK(serialnumber_encode(ref, dec, n, again.data(), again.size()) == used);
+        FUZZ_CHECK(memcmp(again.data(), raw.data(), used) == 0);
+    }
+    const size_t gused = GroupCodec<T>::decode(ref, raw.data(), raw.size(), dec, n);
+    if (GroupCodec<T>::available && (gused > 0)) {
+        check_list(ref, dec, n, small);
+        std::vector<uint8_t> again(GroupCodec<T>::max_size(n));
+        FUZZ_CHECK(GroupCodec<T>::encode(ref, dec, n, again.data(), again.size()) == gused);
+        FUZZ_CHECK(memcmp(again.data(), raw.data(), gused) == 0);
+    }
+    T value = 0;
+    const size_t vused = varint_decode(raw.data(), raw.size(), value);
+    if (vused > 0) {
+        uint8_t v[varint_max_size<T>()];
+        FUZZ_CHECK(varint_encode(value, v) == vused);
+        FUZZ_CHECK(memcmp(v, raw.data(), vused) == 0);
+    }
+}
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size) {
+    FuzzInput in{data, size};
+    switch (in.byte() & 3) {
+        case 0: run<uint8_t>(in); break;
+        case 1: run<uint16_t>(in); break;
+        case 2: run<uint32_t>(in); break;
+        default: run<uint64_t>(in); break;
+    }
+    return 0;
+}
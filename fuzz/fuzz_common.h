@@ -0,0 +1,103 @@
+/*
+Common helpers for the fuzz targets: reading typed values from the fuzzer
+input, a reference implementation of RFC1982 and a check macro.
+
+The reference implementation follows the text of RFC1982, section 3.2, 
+literally and computes in unsigned __int128, so it shares no code (and no 
+modular tricks) with the kernels in SerialNumberOperators.hpp.
+*/
+
+#ifndef fuzz_common_h
+#define fuzz_common_h
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+// abort with a message if a check fails, the fuzzer reports the input
+#define FUZZ_CHECK(cond) \
+    do { \
+        if (!(cond)) { \
+            fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            abort(); \
+        } \
+    } while (0)
+
+typedef unsigned __int128 fuzz_wide;
+
+// reads little endian values from the input, zero once it is exhausted
+class FuzzInput {
+    public:
+        FuzzInput(const uint8_t* data, size_t size) : d{data}, n{size}, pos{0} {}
+
+        uint8_t byte(void) {
+            return (pos < n) ? d[pos++] : 0;
+        }
+
+        template <class T>
+        T value(void) {
+            T v = 0;
+            for (size_t i=0; i<sizeof(T); i++) {
+                v = static_cast<T>(v | (static_cast<T>(byte()) << (8 * i)));
+            }
+            return v;
+        }
+
+        const uint8_t* rest(void) const { return d + pos; }
+        size_t rest_size(void) const { return n - pos; }
+
+    private:
+        const uint8_t* d;
+        size_t n;
+        size_t pos;
+};
+
+// 2^SERIAL_BITS and 2^(SERIAL_BITS - 1)
+template <class T>
+fuzz_wide ref_modulus(void) {
+    return static_cast<fuzz_wide>(1) << (sizeof(T) * 8);
+}
+
+template <class T>
+fuzz_wide ref_half(void) {
+    return static_cast<fuzz_wide>(1) << (sizeof(T) * 8 - 1);
+}
+
+// RFC1982, section 3.2: s1 is less than s2
+template <class T>
+bool ref_less(T s1, T s2) {
+    const fuzz_wide i1 = s1;
+    const fuzz_wide i2 = s2;
+    if (i1 == i2) return false;
+    return ((i1 < i2) && (i2 - i1 < ref_half<T>())) ||
+           ((i1 > i2) && (i1 - i2 > ref_half<T>()));
+}
+
+// RFC1982, section 3.2: s1 is greater than s2
+template <class T>
+bool ref_greater(T s1, T s2) {
+    const fuzz_wide i1 = s1;
+    const fuzz_wide i2 = s2;
+    if (i1 == i2) return false;
+    return ((i1 < i2) && (i2 - i1 > ref_half<T>())) ||
+           ((i1 > i2) && (i1 - i2 < ref_half<T>()));
+}
+
+// the pair is at the critical distance 2^(SERIAL_BITS - 1)
+template <class T>
+bool ref_tie(T s1, T s2) {
+    const fuzz_wide i1 = s1;
+    const fuzz_wide i2 = s2;
+    return ((i1 > i2) ? (i1 - i2) : (i2 - i1)) == ref_half<T>();
+}
+
+// sn is one of start, start + 1, ..., start + len - 1 (modulo 2^SERIAL_BITS)
+template <class T>
+bool ref_in_window(T sn, T start, T len) {
+    const fuzz_wide end = static_cast<fuzz_wide>(start) + len;
+    if (end <= ref_modulus<T>()) return (sn >= start) && (static_cast<fuzz_wide>(sn) < end);
+    return (sn >= start) || (static_cast<fuzz_wide>(sn) < end - ref_modulus<T>());
+}
+
+#endif // fuzz_common_h
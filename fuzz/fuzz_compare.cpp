@@ -0,0 +1,117 @@
+/*
+Fuzz target for the comparisons: operators, kernels, lookup table kernels
+(uint8_t), tie policies, out-parameter variants and in_window() (scalar 
+and array), all checked against the reference implementation.
+
+Input layout (little endian, missing bytes read as zero):
+
+    1 byte      width: 0 = uint8_t, 1 = uint16_t, 2 = uint32_t, 3 = uint64_t
+    sizeof(T)   a
+    sizeof(T)   b
+    sizeof(T)   window start
+    sizeof(T)   window length
+    1 byte      n (modulo 65), number of values for in_window() on arrays
+    n*sizeof(T) values
+*/
+
+#include "fuzz_common.h"
+#include "SerialNumber.h"
+
+template <class T>
+static void check_pair(T a, T b) {
+    const SerialNumber<T> sa{a};
+    const SerialNumber<T> sb{b};
+    const bool lt = ref_less(a, b);
+    const bool gt = ref_greater(a, b);
+    const bool eq = (a == b);
+    const bool tie = ref_tie(a, b);
+
+    // kernels
+    FUZZ_CHECK(serialnumber_less(a, b) == lt);
+    FUZZ_CHECK(serialnumber_greater(a, b) == gt);
+
+    // operators on SerialNumber and SerialNumber
+    FUZZ_CHECK((sa == sb) == eq);
+    FUZZ_CHECK((sa != sb) == !eq);
+    FUZZ_CHECK((sa < sb) == lt);
+    FUZZ_CHECK((sa > sb) == gt);
+    FUZZ_CHECK((sa <= sb) == (lt || eq));
+    FUZZ_CHECK((sa >= sb) == (gt || eq));
+
+    // operators on SerialNumber and plain number, both orders
+    FUZZ_CHECK((sa == b) == eq);
+    FUZZ_CHECK((a != sb) == !eq);
+    FUZZ_CHECK((sa < b) == lt);
+    FUZZ_CHECK((a < sb) == lt);
+    FUZZ_CHECK((sa > b) == gt);
+    FUZZ_CHECK((a > sb) == gt);
+    FUZZ_CHECK((sa <= b) == (lt || eq));
+    FUZZ_CHECK((a >= sb) == (gt || eq));
+
+    // tie policies
+    FUZZ_CHECK(serialnumber_less<SerialNumberTieFalse>(sa, sb) == lt);
+    FUZZ_CHECK(serialnumber_greater<SerialNumberTieFalse>(sa, sb) == gt);
+    FUZZ_CHECK(serialnumber_less<SerialNumberTieLess>(sa, sb) == (lt || tie));
+    FUZZ_CHECK(serialnumber_greater<SerialNumberTieLess>(sa, sb) == gt);
+    FUZZ_CHECK(serialnumber_less<SerialNumberTieGreater>(sa, sb) == lt);
+    FUZZ_CHECK(serialnumber_greater<SerialNumberTieGreater>(sa, sb) == (gt || tie));
+
+    // out-parameter variants
+    bool t1 = !tie;
+    bool t2 = !tie;
+    FUZZ_CHECK(serialnumber_less(sa, sb, t1) == lt);
+    FUZZ_CHECK(serialnumber_greater(sa, sb, t2) == gt);
+    FUZZ_CHECK(t1 == tie);
+    FUZZ_CHECK(t2 == tie);
+
+    // exactly one of lower, greater, equal, tie
+    FUZZ_CHECK((lt + gt + eq + tie) == 1);
+}
+
+// lookup table kernels exist for uint8_t only
+template <class T>
+static void check_tables(T, T) {}
+
+static void check_tables(uint8_t a, uint8_t b) {
+    FUZZ_CHECK(serialnumber_less_table(a, b) == ref_less(a, b));
+    FUZZ_CHECK(serialnumber_greater_table(a, b) == ref_greater(a, b));
+}
+
+template <class T>
+static void run(FuzzInput& in) {
+    const T a = in.value<T>();
+    const T b = in.value<T>();
+    check_pair(a, b);
+    check_pair(b, a);
+    check_pair(a, a);
+    check_tables(a, b);
+
+    const T start = in.value<T>();
+    const T len = in.value<T>();
+    FUZZ_CHECK(in_window(SerialNumber<T>{a}, SerialNumber<T>{start}, len) == ref_in_window(a, start, len));
+    FUZZ_CHECK(in_window(SerialNumber<T>{b}, SerialNumber<T>{start}, len) == ref_in_window(b, start, len));
+
+    const size_t n = in.byte() % 65;
+    T values[64];
+    uint8_t result[64];
+    for (size_t i=0; i<n; i++) values[i] = in.value<T>();
+    const size_t count = in_window(values, n, SerialNumber<T>{start}, len, result);
+    size_t expected = 0;
+    for (size_t i=0; i<n; i++) {
+        const bool inside = ref_in_window(values[i], start, len);
+        FUZZ_CHECK(result[i] == (inside ? 1 : 0));
+        expected += inside;
+    }
+    FUZZ_CHECK(count == expected);
+}
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size) {
+    FuzzInput in{data, size};
+    switch (in.byte() & 3) {
+        case 0: run<uint8_t>(in); break;
+        case 1: run<uint16_t>(in); break;
+        case 2: run<uint32_t>(in); break;
+        default: run<uint64_t>(in); break;
+    }
+    return 0;
+}
@@ -0,0 +1,76 @@
+/*
+Driver for the fuzz targets without libFuzzer (e.g. with GCC): runs the
+target on all files given on the command line (directories are read 
+recursively one level deep), then on a number of pseudo-random inputs.
+
+    fuzz_target [-random=N] [-seed=S] file_or_directory ...
+*/
+
+#include <dirent.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size);
+
+static size_t run_file(const std::string& path) {
+    FILE* f = fopen(path.c_str(), "rb");
+    if (f == nullptr) return 0;
+    std::vector<uint8_t> data;
+    int c;
+    while ((c = fgetc(f)) != EOF) data.push_back(static_cast<uint8_t>(c));
+    fclose(f);
+    // exact size, so that reads past the end are detected
+    uint8_t* buf = static_cast<uint8_t*>(malloc(data.size()));
+    if (!data.empty()) memcpy(buf, data.data(), data.size());
+    LLVMFuzzerTestOneInput(buf, data.size());
+    free(buf);
+    return 1;
+}
+
+static size_t run_path(const std::string& path) {
+    DIR* dir = opendir(path.c_str());
+    if (dir == nullptr) return run_file(path);
+    size_t count = 0;
+    while (struct dirent* e = readdir(dir)) {
+        if (e->d_name[0] == '.') continue;
+        count += run_file(path + "/" + e->d_name);
+    }
+    closedir(dir);
+    return count;
+}
+
+int main(int argc, char** argv) {
+    unsigned long random_runs = 0;
+    unsigned long seed = 1;
+    size_t files = 0;
+    for (int i=1; i<argc; i++) {
+        if (strncmp(argv[i], "-random=", 8) == 0) random_runs = strtoul(argv[i] + 8, nullptr, 10);
+        else if (strncmp(argv[i], "-seed=", 6) == 0) seed = strtoul(argv[i] + 6, nullptr, 10);
+        else files += run_path(argv[i]);
+    }
+
+    // simple xorshift generator, inputs of 0 ... 600 bytes, every fourth
+    // byte on average taken from edge values (wrap, half range)
+    static const uint8_t edges[] = {0x00, 0x01, 0x7F, 0x80, 0x81, 0xFE, 0xFF};
+    uint64_t x = 0x9E3779B97F4A7C15ull ^ seed;
+    std::vector<uint8_t> data;
+    for (unsigned long r=0; r<random_runs; r++) {
+        x ^= x << 13; x ^= x >> 7; x ^= x << 17;
+        data.resize(x % 601);
+        for (size_t i=0; i<data.size(); i++) {
+            x ^= x << 13; x ^= x >> 7; x ^= x << 17;
+            data[i] = ((x >> 40) % 4 == 0) ? edges[(x >> 48) % sizeof(edges)] : static_cast<uint8_t>(x);
+        }
+        uint8_t* buf = static_cast<uint8_t*>(malloc(data.size()));
+        if (!data.empty()) memcpy(buf, data.data(), data.size());
+        LLVMFuzzerTestOneInput(buf, data.size());
+        free(buf);
+    }
+
+    printf("%s: %zu files, %lu random inputs, no failures\n", argv[0], files, random_runs);
+    return 0;
+}
@@ -0,0 +1,99 @@
+/**
+ @file    ArbitrationFilter.h
+ @brief   Header file for ArbitrationFilter class
+ @author  SerialNumber contributors
+ @version 1.2.0
+ @date    2026-10-16
+ @section license_arbitrationfilter_h License
+  
+ The MIT Licence (MIT)
+ 
+ Copyright (c) 2026 SerialNumber contributors
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+*/
+
+/*
+An ArbitrationFilter receives the same stream of packets via N redundant
+lines (e.g. A/B multicast feeds) and lets pass the first copy of each 
+packet only. Packets are identified by their SerialNumber.
+
+The filter remembers the SerialNumbers seen within a window of the last W
+SerialNumbers (counting back from the highest one seen) in a bitmap. A 
+packet is accepted if it is newer than the highest SerialNumber seen so 
+far, or if it is within the window and has not been seen before. All 
+other packets are dropped, i.e. duplicates and packets which are too old
+to tell.
+
+Packets are accepted in the order they arrive. A packet which arrives
+late on all lines is still accepted as long as it is within the window, 
+but it is not reordered.
+
+Additionally, for each line the filter counts the gaps, i.e. the number 
+of SerialNumbers which were skipped on that line. Packets arriving late
+(out of order) on a line are not subtracted again.
+
+The filter does not allocate memory. W must be a power of two and a 
+multiple of 32, and must be lower than 2^(SERIAL_BITS - 1).
+*/
+
+#ifndef ArbitrationFilter_h
+#define ArbitrationFilter_h
+
+#include <string.h>
+#include "SerialNumber.h"
+
+/* Declaration of the ArbitrationFilter class template */
+
+template <class T, size_t N, size_t W=1024>
+class ArbitrationFilter {
+    public:
+        // constructor
+        ArbitrationFilter(void); ///< constructor
+
+        // process packet sn received on line, return true if it is the first copy
+        bool accept(size_t line, const SerialNumber<T>& sn);
+
+        // highest SerialNumber seen so far
+        SerialNumber<T> highest(void) const;
+
+        // number of SerialNumbers skipped on line
+        unsigned long gaps(size_t line) const;
+
+        // number of dropped packets (duplicates and packets too old)
+        unsigned long dropped(void) const;
+
+        // forget everything
+        void reset(void);
+
+    private:
+        bool test_and_set(T sn);
+        void clear(T first, T count);
+
+        uint32_t bits[W / 32];
+        SerialNumber<T> hi;
+        SerialNumber<T> expected[N];
+        unsigned long gapcount[N];
+        unsigned long drops;
+        bool started;
+        bool line_started[N];
+};
+
+#include "ArbitrationFilterClass.hpp"
+
+#endif // ArbitrationFilter_h
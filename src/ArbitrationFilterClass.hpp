@@ -0,0 +1,165 @@
+/**
+ @file    ArbitrationFilterClass.hpp
+ @brief   Implementation file for ArbitrationFilter class
+ @author  SerialNumber contributors
+ @version 1.2.0
+ @date    2026-10-16
+ @section license_arbitrationfilter_class_hpp License
+  
+ The MIT Licence (MIT)
+ 
+ Copyright (c) 2026 SerialNumber contributors
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+*/
+
+/**
+ * @brief  Constructor
+ */
+template <class T, size_t N, size_t W>
+ArbitrationFilter<T, N, W>::ArbitrationFilter(void) {
+    static_assert((W >= 32) && ((W & (W - 1)) == 0), "W must be a power of two and at least 32");
+    static_assert(static_cast<uint64_t>(W) < (static_cast<uint64_t>(1) << ((sizeof(T) * 8) - 1)), "W must be lower than 2^(SERIAL_BITS - 1)");
+    reset();
+}
+
+/**
+ * @brief  Process a packet
+ * @param  line  line the packet was received on (0 ... N-1)
+ * @param  sn    SerialNumber of the packet
+ * @return true if this is the first copy of the packet, false otherwise
+ */
+template <class T, size_t N, size_t W>
+bool ArbitrationFilter<T, N, W>::accept(size_t line, const SerialNumber<T>& sn) {
+    // gap detection per line
+    if (!line_started[line]) {
+        line_started[line] = true;
+        expected[line] = sn;
+    }
+    if (sn > expected[line]) {
+        gapcount[line] += static_cast<T>(sn.value() - expected[line].value());
+    }
+    if (sn >= expected[line]) {
+        expected[line] = static_cast<T>(sn.value() + 1);
+    }
+
+    // arbitration between lines
+    if (!started) {
+        started = true;
+        hi = sn;
+        test_and_set(sn.value());
+        return true;
+    }
+    if (sn > hi) {
+        // move window forward, forget SerialNumbers which fall out
+        const T d = static_cast<T>(sn.value() - hi.value());
+        if (d >= W) {
+            memset(bits, 0, sizeof(bits));
+        }
+        else {
+            clear(static_cast<T>(hi.value() + 1), d);
+        }
+        hi = sn;
+        test_and_set(sn.value());
+        return true;
+    }
+    if (static_cast<T>(hi.value() - sn.value()) >= W) {
+        // too old to tell
+        drops++;
+        return false;
+    }
+    if (test_and_set(sn.value())) {
+        drops++;
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief  Highest SerialNumber seen so far
+ */
+template <class T, size_t N, size_t W>
+SerialNumber<T> ArbitrationFilter<T, N, W>::highest(void) const {
+    return hi;
+}
+
+/**
+ * @brief  Number of SerialNumbers skipped on a line
+ * @param  line  line (0 ... N-1)
+ */
+template <class T, size_t N, size_t W>
+unsigned long ArbitrationFilter<T, N, W>::gaps(size_t line) const {
+    return gapcount[line];
+}
+
+/**
+ * @brief  Number of dropped packets
+ */
+template <class T, size_t N, size_t W>
+unsigned long ArbitrationFilter<T, N, W>::dropped(void) const {
+    return drops;
+}
+
+/**
+ * @brief  Forget all SerialNumbers and reset all counters
+ */
+template <class T, size_t N, size_t W>
+void ArbitrationFilter<T, N, W>::reset(void) {
+    memset(bits, 0, sizeof(bits));
+    for (size_t l=0; l<N; l++) {
+        expected[l] = T(0);
+        gapcount[l] = 0;
+        line_started[l] = false;
+    }
+    hi = T(0);
+    drops = 0;
+    started = false;
+}
+
+/**
+ * @brief  Mark SerialNumber as seen
+ * @return true if the SerialNumber has been seen before
+ */
+template <class T, size_t N, size_t W>
+bool ArbitrationFilter<T, N, W>::test_and_set(T sn) {
+    const T pos = static_cast<T>(sn & (W - 1));
+    const uint32_t mask = static_cast<uint32_t>(1) << (pos % 32);
+    const bool seen = (bits[pos / 32] & mask) != 0;
+    bits[pos / 32] |= mask;
+    return seen;
+}
+
+/**
+ * @brief  Mark SerialNumbers first ... first+count-1 as not seen
+ * @note   Whole words are cleared at once, masks are only needed for the
+ *         partial words at both ends. Words never wrap around the end of
+ *         the bitmap, since W is a multiple of 32.
+ */
+template <class T, size_t N, size_t W>
+void ArbitrationFilter<T, N, W>::clear(T first, T count) {
+    size_t pos = static_cast<size_t>(first & (W - 1));
+    size_t left = count;
+    while (left > 0) {
+        const size_t bit = pos % 32;
+        const size_t n = (left < 32 - bit) ? left : 32 - bit;
+        const uint32_t mask = (n == 32) ? ~static_cast<uint32_t>(0) : (((static_cast<uint32_t>(1) << n) - 1) << bit);
+        bits[pos / 32] &= ~mask;
+        pos = (pos + n) & (W - 1);
+        left -= n;
+    }
+}
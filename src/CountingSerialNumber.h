@@ -0,0 +1,84 @@
+/**
+ @file    CountingSerialNumber.h
+ @brief   Header file for CountingSerialNumber class
+ @author  SerialNumber contributors
+ @version 1.2.0
+ @date    2026-10-16
+ @section license_countingserialnumber_h License
+  
+ The MIT Licence (MIT)
+ 
+ Copyright (c) 2026 SerialNumber contributors
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+*/
+
+/*
+A CountingSerialNumber behaves like a SerialNumber with respect to 
+incrementing, but additionally counts how often it wrapped around from 
+the maximum value to zero (rollovers). Together, rollover count and value
+form an "extended" value which does not wrap around (at least not for a
+very long time):
+
+    extended = rollovers * 2^SERIAL_BITS + value
+
+The rollover counter is updated without any branches: after an increment,
+a wrap-around has happened if and only if the new value is zero. After 
+advancing by k, a wrap-around has happened if and only if the new value is
+lower than the old one (i.e. the carry of the addition).
+
+The extended value is returned as uint64_t and is therefore only 
+meaningful if sizeof(T) + sizeof(R) <= 8. Otherwise, it is truncated.
+*/
+
+#ifndef CountingSerialNumber_h
+#define CountingSerialNumber_h
+
+#include "SerialNumber.h"
+
+/* Declaration of the CountingSerialNumber class template */
+
+template <class T, class R=uint32_t>
+class CountingSerialNumber {
+    public:
+        // constructor
+        CountingSerialNumber(T sn=T(0), R rollovers=R(0)); ///< constructor
+
+        // getter methods
+        T value(void) const;
+        SerialNumber<T> serial(void) const;
+        R rollovers(void) const;
+        uint64_t extended(void) const;
+
+        // advance by k, counting a possible wrap-around
+        CountingSerialNumber& advance(T k);
+
+        // prefix increment operator (no parameters)
+        CountingSerialNumber& operator++ ();
+
+        // postfix increment operator (one int parameter)
+        CountingSerialNumber operator++ (int);
+
+    private:
+        T n;
+        R r;
+};
+
+#include "CountingSerialNumberClass.hpp"
+
+#endif // CountingSerialNumber_h
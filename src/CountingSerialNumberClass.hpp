@@ -0,0 +1,108 @@
+/**
+ @file    CountingSerialNumberClass.hpp
+ @brief   Implementation file for CountingSerialNumber class
+ @author  SerialNumber contributors
+ @version 1.2.0
+ @date    2026-10-16
+ @section license_countingserialnumber_class_hpp License
+  
+ The MIT Licence (MIT)
+ 
+ Copyright (c) 2026 SerialNumber contributors
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+*/
+
+/**
+ * @brief  Constructor
+ * @param  sn         initial value
+ * @param  rollovers  initial number of rollovers
+ */
+template <class T, class R>
+CountingSerialNumber<T, R>::CountingSerialNumber(T sn, R rollovers) : n{sn}, r{rollovers} {}
+
+/**
+ * @brief  Getter function for the stored value
+ * @return The stored value
+ */
+template <class T, class R>
+T CountingSerialNumber<T, R>::value(void) const {
+    return n;
+}
+
+/**
+ * @brief  Getter function for the stored value as SerialNumber
+ * @return The stored value as SerialNumber
+ */
+template <class T, class R>
+SerialNumber<T> CountingSerialNumber<T, R>::serial(void) const {
+    return SerialNumber<T>{n};
+}
+
+/**
+ * @brief  Getter function for the number of rollovers
+ * @return Number of wrap-arounds from maximum value to zero
+ */
+template <class T, class R>
+R CountingSerialNumber<T, R>::rollovers(void) const {
+    return r;
+}
+
+/**
+ * @brief  Getter function for the extended value
+ * @return rollovers * 2^SERIAL_BITS + value (modulo 2^64)
+ */
+template <class T, class R>
+uint64_t CountingSerialNumber<T, R>::extended(void) const {
+    return (sizeof(T) >= 8) ? static_cast<uint64_t>(n) 
+                            : ((static_cast<uint64_t>(r) << ((sizeof(T) * 8) % 64)) | n);
+}
+
+/**
+ * @brief  Advance by k
+ * @param  k  increment
+ * @note   Counts at most one rollover, as k is lower than 2^SERIAL_BITS.
+ */
+template <class T, class R>
+CountingSerialNumber<T, R>& CountingSerialNumber<T, R>::advance(T k) {
+    const T old = n;
+    n = static_cast<T>(old + k);
+    r = static_cast<R>(r + (n < old));
+    return *this;
+}
+
+/**
+ * @brief  Prefix increment operator
+ */
+template <class T, class R>
+CountingSerialNumber<T, R>& CountingSerialNumber<T, R>::operator++ () {
+    ++n;
+    r = static_cast<R>(r + (n == 0));
+    SERIALNUMBER_COUNT_INCREMENT(T, n);
+    return *this;
+}
+
+/**
+ * @brief  Postfix increment operator
+ */
+template <class T, class R>
+CountingSerialNumber<T, R> CountingSerialNumber<T, R>::operator++ (int) {
+    CountingSerialNumber temp{*this};
+    ++(*this);
+    return temp;
+}
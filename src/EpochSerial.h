@@ -0,0 +1,205 @@
+/**
+ @file    EpochSerial.h
+ @brief   Header file for EpochSerial class (epoch + RFC1982 serial number)
+ @author  SerialNumber contributors
+ @version 1.2.0
+ @date    2026-10-16
+ @section license_epochserial_h License
+  
+ The MIT Licence (MIT)
+ 
+ Copyright (c) 2026 SerialNumber contributors
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+*/
+
+/*
+An EpochSerial is a pair of an epoch and a SerialNumber, e.g. the 
+(term, index) or (epoch, seq) pairs used in replication logs.
+
+The epoch is a plain, non-wrapping unsigned counter. It is expected to
+change rarely (e.g. on every restart or leader change) and to never 
+wrap around. The serial part is a SerialNumber<T> and wraps as usual.
+
+Ordering: Two EpochSerials are compared by their epochs first. Only if 
+the epochs are identical, the serial parts are compared according to 
+RFC1982. Consequently, the "critical distance" rules of RFC1982 only
+apply if the epochs are equal. The epoch type E must be unsigned.
+
+Whenever a matching unsigned integer type exists, epoch and serial are 
+packed into a single word (epoch in the upper bits, serial in the lower
+bits), e.g. EpochSerial<uint16_t, uint16_t> occupies a single uint32_t
+and EpochSerial<uint32_t, uint32_t> occupies a single uint64_t. 
+Otherwise, epoch and serial are stored side by side. In packed form, the
+comparison operators work on the packed word: equality is a single word
+comparison, and the ordering operators compare the whole words as plain
+unsigned numbers unless they only differ in the serial bits.
+
+Constructing an EpochSerial from an epoch alone is explicit, so that a
+plain number is not silently taken as an epoch with serial zero. 
+*/
+
+#ifndef EpochSerial_h
+#define EpochSerial_h
+
+#include "SerialNumber.h"
+
+#ifndef __AVR__
+#include <type_traits>
+#endif
+
+/* Helper templates for selecting the storage of an EpochSerial */
+
+// unsigned integer type with exactly BYTES bytes, void if no such type exists
+template <unsigned int BYTES>
+struct EpochSerialWord {
+    typedef void type; ///< no suitable type, store epoch and serial separately
+};
+
+#ifdef UINT16_MAX
+template <>
+struct EpochSerialWord<2> {
+    typedef uint16_t type; ///< packed storage type
+};
+#endif
+
+#ifdef UINT32_MAX
+template <>
+struct EpochSerialWord<4> {
+    typedef uint32_t type; ///< packed storage type
+};
+#endif
+
+#ifdef UINT64_MAX
+template <>
+struct EpochSerialWord<8> {
+    typedef uint64_t type; ///< packed storage type
+};
+#endif
+
+// storage with epoch and serial packed into a single word W
+template <class E, class T, class W>
+class EpochSerialStorage {
+    public:
+        EpochSerialStorage(E epoch, T sn) : w{static_cast<W>((static_cast<W>(epoch) << (sizeof(T) * 8)) | sn)} {} ///< constructor
+        E epoch(void) const { return static_cast<E>(w >> (sizeof(T) * 8)); } ///< get epoch
+        T serial(void) const { return static_cast<T>(w); }                   ///< get serial
+        void set_serial(T sn) { w = static_cast<W>((w & ~static_cast<W>(static_cast<T>(~T(0)))) | sn); } ///< set serial only
+
+        // comparison of packed words
+        static bool equal(const EpochSerialStorage& a, const EpochSerialStorage& b) { return a.w == b.w; } ///< equal
+        static bool less(const EpochSerialStorage& a, const EpochSerialStorage& b);    ///< lower than
+        static bool greater(const EpochSerialStorage& a, const EpochSerialStorage& b); ///< greater than
+
+    private:
+        W w;
+};
+
+// storage with epoch and serial side by side (no suitable word type)
+template <class E, class T>
+class EpochSerialStorage<E, T, void> {
+    public:
+        EpochSerialStorage(E epoch, T sn) : e{epoch}, n{sn} {} ///< constructor
+        E epoch(void) const { return e; }    ///< get epoch
+        T serial(void) const { return n; }   ///< get serial
+        void set_serial(T sn) { n = sn; }    ///< set serial only
+
+        // comparison of epoch and serial
+        static bool equal(const EpochSerialStorage& a, const EpochSerialStorage& b);   ///< equal
+        static bool less(const EpochSerialStorage& a, const EpochSerialStorage& b);    ///< lower than
+        static bool greater(const EpochSerialStorage& a, const EpochSerialStorage& b); ///< greater than
+
+    private:
+        E e;
+        T n;
+};
+
+/* Declaration of the EpochSerial class template */
+
+template <class E, class T>
+class EpochSerial {
+#ifndef __AVR__
+    static_assert(std::is_unsigned<E>::value, "epoch type E must be an unsigned integer type");
+#else
+    static_assert(E(-1) > E(0), "epoch type E must be an unsigned integer type");
+#endif
+
+    public:
+        // default constructor, epoch and serial are zero
+        EpochSerial(void); ///< constructor
+
+        // constructor from an epoch alone, serial is zero
+        explicit EpochSerial(E epoch); ///< constructor
+
+        // constructor
+        EpochSerial(E epoch, T sn); ///< constructor
+
+        // constructor from a SerialNumber
+        EpochSerial(E epoch, const SerialNumber<T>& sn); ///< constructor
+
+        // getter methods
+        E epoch(void) const;
+        SerialNumber<T> serial(void) const;
+
+        // prefix increment operator (no parameters), increments serial only
+        EpochSerial& operator++ ();
+
+        // postfix increment operator (one int parameter), increments serial only
+        EpochSerial operator++ (int);
+
+        // comparison functions, used by the comparison operators
+        static bool equal(const EpochSerial& es1, const EpochSerial& es2);
+        static bool less(const EpochSerial& es1, const EpochSerial& es2);
+        static bool greater(const EpochSerial& es1, const EpochSerial& es2);
+
+    private:
+        typedef EpochSerialStorage<E, T, typename EpochSerialWord<sizeof(E) + sizeof(T)>::type> Storage;
+        Storage s;
+};
+
+#include "EpochSerialClass.hpp"
+
+/* Declaration of comparison operators for EpochSerial objects */
+
+// equality operator
+template <class E, class T>
+bool operator== (const EpochSerial<E, T>& es1, const EpochSerial<E, T>& es2);
+
+// inequality operator
+template <class E, class T>
+bool operator!= (const EpochSerial<E, T>& es1, const EpochSerial<E, T>& es2);
+
+// lower-than operator
+template <class E, class T>
+bool operator< (const EpochSerial<E, T>& es1, const EpochSerial<E, T>& es2);
+
+// greater-than operator
+template <class E, class T>
+bool operator> (const EpochSerial<E, T>& es1, const EpochSerial<E, T>& es2);
+
+// lower-or-equal operator
+template <class E, class T>
+bool operator<= (const EpochSerial<E, T>& es1, const EpochSerial<E, T>& es2);
+
+// greater-or-equal operator
+template <class E, class T>
+bool operator>= (const EpochSerial<E, T>& es1, const EpochSerial<E, T>& es2);
+
+#include "EpochSerialOperators.hpp"
+
+#endif // EpochSerial_h
@@ -0,0 +1,176 @@
+/**
+ @file    EpochSerialClass.hpp
+ @brief   Implementation file for EpochSerial class
+ @author  SerialNumber contributors
+ @version 1.2.0
+ @date    2026-10-16
+ @section license_epochserial_class_hpp License
+  
+ The MIT Licence (MIT)
+ 
+ Copyright (c) 2026 SerialNumber contributors
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+*/
+
+/* Definition of comparison functions of the storage classes */
+
+/**
+ * @brief  Lower-than comparison of packed words
+ * @note   If the words differ in the epoch bits, the epochs decide, and 
+ *         so does a plain comparison of the whole words. Otherwise, the 
+ *         serial bits are compared according to RFC1982.
+ */
+template <class E, class T, class W>
+bool EpochSerialStorage<E, T, W>::less(const EpochSerialStorage& a, const EpochSerialStorage& b) {
+    if (static_cast<W>(a.w ^ b.w) >> (sizeof(T) * 8)) return a.w < b.w;
+    return SerialNumber<T>{static_cast<T>(a.w)} < SerialNumber<T>{static_cast<T>(b.w)};
+}
+
+/**
+ * @brief  Greater-than comparison of packed words
+ */
+template <class E, class T, class W>
+bool EpochSerialStorage<E, T, W>::greater(const EpochSerialStorage& a, const EpochSerialStorage& b) {
+    if (static_cast<W>(a.w ^ b.w) >> (sizeof(T) * 8)) return a.w > b.w;
+    return SerialNumber<T>{static_cast<T>(a.w)} > SerialNumber<T>{static_cast<T>(b.w)};
+}
+
+/**
+ * @brief  Equality comparison of epoch and serial
+ */
+template <class E, class T>
+bool EpochSerialStorage<E, T, void>::equal(const EpochSerialStorage& a, const EpochSerialStorage& b) {
+    return (a.e == b.e) && (a.n == b.n);
+}
+
+/**
+ * @brief  Lower-than comparison of epoch and serial
+ */
+template <class E, class T>
+bool EpochSerialStorage<E, T, void>::less(const EpochSerialStorage& a, const EpochSerialStorage& b) {
+    if (a.e != b.e) return a.e < b.e;
+    return SerialNumber<T>{a.n} < SerialNumber<T>{b.n};
+}
+
+/**
+ * @brief  Greater-than comparison of epoch and serial
+ */
+template <class E, class T>
+bool EpochSerialStorage<E, T, void>::greater(const EpochSerialStorage& a, const EpochSerialStorage& b) {
+    if (a.e != b.e) return a.e > b.e;
+    return SerialNumber<T>{a.n} > SerialNumber<T>{b.n};
+}
+
+/* Definition of EpochSerial */
+
+/**
+ * @brief  Default constructor, epoch and serial are zero
+ */
+template <class E, class T>
+EpochSerial<E, T>::EpochSerial(void) : s{E(0), T(0)} {}
+
+/**
+ * @brief  Constructor
+ * @param  epoch  epoch (plain, non-wrapping counter), serial is zero
+ * @note   Explicit, so that a plain number is not silently converted to
+ *         an EpochSerial.
+ */
+template <class E, class T>
+EpochSerial<E, T>::EpochSerial(E epoch) : s{epoch, T(0)} {}
+
+/**
+ * @brief  Constructor
+ * @param  epoch  epoch (plain, non-wrapping counter)
+ * @param  sn     value of the serial part
+ */
+template <class E, class T>
+EpochSerial<E, T>::EpochSerial(E epoch, T sn) : s{epoch, sn} {}
+
+/**
+ * @brief  Constructor
+ * @param  epoch  epoch (plain, non-wrapping counter)
+ * @param  sn     serial part
+ */
+template <class E, class T>
+EpochSerial<E, T>::EpochSerial(E epoch, const SerialNumber<T>& sn) : s{epoch, sn.value()} {}
+
+/**
+ * @brief  Getter function for the epoch
+ * @return The stored epoch
+ */
+template <class E, class T>
+E EpochSerial<E, T>::epoch(void) const {
+    return s.epoch();
+}
+
+/**
+ * @brief  Getter function for the serial part
+ * @return The stored serial part as SerialNumber
+ */
+template <class E, class T>
+SerialNumber<T> EpochSerial<E, T>::serial(void) const {
+    return SerialNumber<T>{s.serial()};
+}
+
+/**
+ * @brief  Prefix increment operator
+ * @note   Only the serial part is incremented. It wraps around as usual,
+ *         the epoch is left untouched.
+ */
+template <class E, class T>
+EpochSerial<E, T>& EpochSerial<E, T>::operator++ () {
+    s.set_serial(static_cast<T>(s.serial() + 1));
+    return *this;
+}
+
+/**
+ * @brief  Postfix increment operator
+ * @note   Only the serial part is incremented. It wraps around as usual,
+ *         the epoch is left untouched.
+ */
+template <class E, class T>
+EpochSerial<E, T> EpochSerial<E, T>::operator++ (int) {
+    EpochSerial temp{*this};
+    s.set_serial(static_cast<T>(s.serial() + 1));
+    return temp;
+}
+
+/**
+ * @brief  Equality comparison, used by operator==
+ */
+template <class E, class T>
+bool EpochSerial<E, T>::equal(const EpochSerial& es1, const EpochSerial& es2) {
+    return Storage::equal(es1.s, es2.s);
+}
+
+/**
+ * @brief  Lower-than comparison, used by operator<
+ */
+template <class E, class T>
+bool EpochSerial<E, T>::less(const EpochSerial& es1, const EpochSerial& es2) {
+    return Storage::less(es1.s, es2.s);
+}
+
+/**
+ * @brief  Greater-than comparison, used by operator>
+ */
+template <class E, class T>
+bool EpochSerial<E, T>::greater(const EpochSerial& es1, const EpochSerial& es2) {
+    return Storage::greater(es1.s, es2.s);
+}
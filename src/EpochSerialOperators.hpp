@@ -0,0 +1,75 @@
+/**
+ @file    EpochSerialOperators.hpp
+ @brief   Implementation file for EpochSerial class
+ @author  SerialNumber contributors
+ @version 1.2.0
+ @date    2026-10-16
+ @section license_epochserial_operators_hpp License
+  
+ The MIT Licence (MIT)
+ 
+ Copyright (c) 2026 SerialNumber contributors
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+*/
+
+/* Definition of comparison operators for EpochSerial objects */
+
+/*
+All ordering operators short-circuit on the epoch: if the epochs differ, 
+the result is determined by the epochs alone and the serial parts are 
+not looked at. Only for equal epochs the RFC1982 rules of SerialNumber
+are evaluated. In packed form, this is done on the packed word (see
+EpochSerialStorage).
+*/
+
+// equality operator
+template <class E, class T>
+bool operator== (const EpochSerial<E, T>& es1, const EpochSerial<E, T>& es2) {
+    return EpochSerial<E, T>::equal(es1, es2);
+}
+
+// inequality operator
+template <class E, class T>
+bool operator!= (const EpochSerial<E, T>& es1, const EpochSerial<E, T>& es2) {
+    return !(es1 == es2);
+}
+
+// lower-than operator
+template <class E, class T>
+bool operator< (const EpochSerial<E, T>& es1, const EpochSerial<E, T>& es2) {
+    return EpochSerial<E, T>::less(es1, es2);
+}
+
+// greater-than operator
+template <class E, class T>
+bool operator> (const EpochSerial<E, T>& es1, const EpochSerial<E, T>& es2) {
+    return EpochSerial<E, T>::greater(es1, es2);
+}
+
+// lower-or-equal operator
+template <class E, class T>
+bool operator<= (const EpochSerial<E, T>& es1, const EpochSerial<E, T>& es2) {
+    return (es1 == es2) || (es1 < es2);
+}
+
+// greater-or-equal operator
+template <class E, class T>
+bool operator>= (const EpochSerial<E, T>& es1, const EpochSerial<E, T>& es2) {
+    return (es1 == es2) || (es1 > es2);
+}
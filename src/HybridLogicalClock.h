@@ -0,0 +1,150 @@
+/**
+ @file    HybridLogicalClock.h
+ @brief   Header file for HybridLogicalClock and HybridTimestamp classes
+ @author  SerialNumber contributors
+ @version 1.2.0
+ @date    2026-10-16
+ @section license_hybridlogicalclock_h License
+  
+ The MIT Licence (MIT)
+ 
+ Copyright (c) 2026 SerialNumber contributors
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+*/
+
+/*
+A hybrid logical clock (Kulkarni et al., "Logical Physical Clocks and 
+Consistent Snapshots in Globally Distributed Databases") produces 
+timestamps which are close to physical time, but still respect causality
+between events on different nodes, even if the physical clocks of the 
+nodes drift apart.
+
+A HybridTimestamp consists of a physical part (48 bits, e.g. milliseconds
+since some epoch) and a logical part, a SerialNumber<uint16_t>. The 
+logical part counts events within the same physical time. Both are packed
+into a single uint64_t (physical part in the upper 48 bits). Timestamps 
+are ordered by their physical parts first. Only if these are equal, the
+logical parts are compared according to RFC1982.
+
+RFC1982 ordering is only meaningful within half the range of the logical
+part. Therefore, HybridLogicalClock never lets the logical part reach 
+2^15: if more than 32767 events happen within the same physical time, it
+advances the physical part by one and restarts the logical part at zero.
+This way, every timestamp returned is greater than all timestamps 
+returned before, no matter how many events happen per physical tick. 
+
+Consequently, the logical part of timestamps produced by 
+HybridLogicalClock is a plain bounded counter (0 ... 2^15 - 1) which 
+never wraps. For such timestamps, RFC1982 comparison of the logical 
+parts gives the same result as plain comparison, and the wrap-around 
+rules are never used. They only matter for timestamps from other sources
+whose logical counter does wrap (comparisons are then valid for logical 
+parts less than 2^15 apart).
+
+HybridLogicalClock<Clock> keeps the latest timestamp of a node in a 
+single atomic uint64_t. now() (timestamp for a local or send event) and 
+update() (timestamp for a receive event) are lock-free. Clock is a 
+functor returning the current physical time as uint64_t.
+
+HybridLogicalClock requires <atomic> and is thus not available on AVR.
+HybridTimestamp is available on all platforms.
+*/
+
+#ifndef HybridLogicalClock_h
+#define HybridLogicalClock_h
+
+#ifndef __AVR__
+#include <atomic>
+#endif
+#include "SerialNumber.h"
+
+/* Declaration of the HybridTimestamp class */
+
+class HybridTimestamp {
+    public:
+        // constructor
+        HybridTimestamp(uint64_t physical=0, uint16_t logical=0); ///< constructor
+
+        // create from packed representation
+        static HybridTimestamp unpack(uint64_t packed);
+
+        // packed representation
+        uint64_t pack(void) const;
+
+        // getter methods
+        uint64_t physical(void) const;
+        SerialNumber<uint16_t> logical(void) const;
+
+    private:
+        uint64_t p;
+};
+
+/* Declaration of comparison operators for HybridTimestamp objects */
+
+// equality operator
+inline bool operator== (const HybridTimestamp& ts1, const HybridTimestamp& ts2);
+
+// inequality operator
+inline bool operator!= (const HybridTimestamp& ts1, const HybridTimestamp& ts2);
+
+// lower-than operator
+inline bool operator< (const HybridTimestamp& ts1, const HybridTimestamp& ts2);
+
+// greater-than operator
+inline bool operator> (const HybridTimestamp& ts1, const HybridTimestamp& ts2);
+
+// lower-or-equal operator
+inline bool operator<= (const HybridTimestamp& ts1, const HybridTimestamp& ts2);
+
+// greater-or-equal operator
+inline bool operator>= (const HybridTimestamp& ts1, const HybridTimestamp& ts2);
+
+#ifndef __AVR__
+/* Declaration of the HybridLogicalClock class template */
+
+template <class Clock>
+class HybridLogicalClock {
+    public:
+        // constructor
+        HybridLogicalClock(Clock clock=Clock()); ///< constructor
+
+        // not copyable
+        HybridLogicalClock(const HybridLogicalClock&) = delete;            ///< not copyable
+        HybridLogicalClock& operator= (const HybridLogicalClock&) = delete; ///< not copyable
+
+        // timestamp for a local or send event
+        HybridTimestamp now(void);
+
+        // timestamp for receiving a message with timestamp remote
+        HybridTimestamp update(const HybridTimestamp& remote);
+
+        // latest timestamp
+        HybridTimestamp last(void) const;
+
+    private:
+        static HybridTimestamp successor(uint64_t physical, SerialNumber<uint16_t> logical);
+
+        Clock clk;
+        std::atomic<uint64_t> state;
+};
+#endif // __AVR__
+
+#include "HybridLogicalClockClass.hpp"
+
+#endif // HybridLogicalClock_h
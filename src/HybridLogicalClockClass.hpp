@@ -0,0 +1,189 @@
+/**
+ @file    HybridLogicalClockClass.hpp
+ @brief   Implementation file for HybridLogicalClock and HybridTimestamp classes
+ @author  SerialNumber contributors
+ @version 1.2.0
+ @date    2026-10-16
+ @section license_hybridlogicalclock_class_hpp License
+  
+ The MIT Licence (MIT)
+ 
+ Copyright (c) 2026 SerialNumber contributors
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+*/
+
+/**
+ * @brief  Constructor
+ * @param  physical  physical part, only the lower 48 bits are used
+ * @param  logical   logical part
+ */
+inline HybridTimestamp::HybridTimestamp(uint64_t physical, uint16_t logical) : 
+    p{(physical << 16) | logical} {}
+
+/**
+ * @brief  Create timestamp from packed representation
+ * @param  packed  physical part in upper 48 bits, logical part in lower 16 bits
+ */
+inline HybridTimestamp HybridTimestamp::unpack(uint64_t packed) {
+    return HybridTimestamp{packed >> 16, static_cast<uint16_t>(packed)};
+}
+
+/**
+ * @brief  Packed representation
+ * @return physical part in upper 48 bits, logical part in lower 16 bits
+ */
+inline uint64_t HybridTimestamp::pack(void) const {
+    return p;
+}
+
+/**
+ * @brief  Getter function for the physical part
+ */
+inline uint64_t HybridTimestamp::physical(void) const {
+    return p >> 16;
+}
+
+/**
+ * @brief  Getter function for the logical part
+ */
+inline SerialNumber<uint16_t> HybridTimestamp::logical(void) const {
+    return SerialNumber<uint16_t>{static_cast<uint16_t>(p)};
+}
+
+/* Definition of comparison operators for HybridTimestamp objects */
+
+// equality operator
+inline bool operator== (const HybridTimestamp& ts1, const HybridTimestamp& ts2) {
+    return ts1.pack() == ts2.pack();
+}
+
+// inequality operator
+inline bool operator!= (const HybridTimestamp& ts1, const HybridTimestamp& ts2) {
+    return ts1.pack() != ts2.pack();
+}
+
+// lower-than operator
+inline bool operator< (const HybridTimestamp& ts1, const HybridTimestamp& ts2) {
+    if (ts1.physical() != ts2.physical()) return ts1.physical() < ts2.physical();
+    return ts1.logical() < ts2.logical();
+}
+
+// greater-than operator
+inline bool operator> (const HybridTimestamp& ts1, const HybridTimestamp& ts2) {
+    if (ts1.physical() != ts2.physical()) return ts1.physical() > ts2.physical();
+    return ts1.logical() > ts2.logical();
+}
+
+// lower-or-equal operator
+inline bool operator<= (const HybridTimestamp& ts1, const HybridTimestamp& ts2) {
+    return (ts1 == ts2) || (ts1 < ts2);
+}
+
+// greater-or-equal operator
+inline bool operator>= (const HybridTimestamp& ts1, const HybridTimestamp& ts2) {
+    return (ts1 == ts2) || (ts1 > ts2);
+}
+
+#ifndef __AVR__
+
+/**
+ * @brief  Constructor
+ * @param  clock  functor returning the current physical time
+ */
+template <class Clock>
+HybridLogicalClock<Clock>::HybridLogicalClock(Clock clock) : clk{clock}, state{0} {}
+
+/**
+ * @brief  Timestamp for a local or send event
+ * @return A timestamp greater than all timestamps returned before
+ * @note   The logical part stays below 2^15 (see above).
+ */
+template <class Clock>
+HybridTimestamp HybridLogicalClock<Clock>::now(void) {
+    const uint64_t pt = HybridTimestamp{clk()}.physical();
+    uint64_t old = state.load(std::memory_order_relaxed);
+    HybridTimestamp next;
+    do {
+        const HybridTimestamp cur = HybridTimestamp::unpack(old);
+        if (pt > cur.physical()) {
+            next = HybridTimestamp{pt, 0};
+        }
+        else {
+            next = successor(cur.physical(), cur.logical());
+        }
+    } while (!state.compare_exchange_weak(old, next.pack(), std::memory_order_acq_rel, std::memory_order_relaxed));
+    return next;
+}
+
+/**
+ * @brief  Timestamp for receiving a message
+ * @param  remote  timestamp of the message
+ * @return A timestamp greater than remote and all timestamps returned before
+ * @note   The logical part stays below 2^15 (see above). remote must 
+ *         come from a HybridLogicalClock as well.
+ */
+template <class Clock>
+HybridTimestamp HybridLogicalClock<Clock>::update(const HybridTimestamp& remote) {
+    const uint64_t pt = HybridTimestamp{clk()}.physical();
+    uint64_t old = state.load(std::memory_order_relaxed);
+    HybridTimestamp next;
+    do {
+        const HybridTimestamp cur = HybridTimestamp::unpack(old);
+        const uint64_t l = cur.physical();
+        const uint64_t m = remote.physical();
+        const uint64_t lmax = (l > m) ? ((l > pt) ? l : pt) : ((m > pt) ? m : pt);
+        if ((lmax == l) && (lmax == m)) {
+            // tie-break between logical parts according to RFC1982
+            next = successor(lmax, (remote.logical() > cur.logical()) ? remote.logical() : cur.logical());
+        }
+        else if (lmax == l) {
+            next = successor(lmax, cur.logical());
+        }
+        else if (lmax == m) {
+            next = successor(lmax, remote.logical());
+        }
+        else {
+            next = HybridTimestamp{lmax, 0};
+        }
+    } while (!state.compare_exchange_weak(old, next.pack(), std::memory_order_acq_rel, std::memory_order_relaxed));
+    return next;
+}
+
+/**
+ * @brief  Next timestamp after (physical, logical)
+ * @note   Advances the physical part instead of letting the logical part
+ *         reach 2^15, i.e. half the range of SerialNumber<uint16_t>. The
+ *         logical part is thus a plain bounded counter, it never wraps.
+ */
+template <class Clock>
+HybridTimestamp HybridLogicalClock<Clock>::successor(uint64_t physical, SerialNumber<uint16_t> logical) {
+    ++logical;
+    if (logical.value() >= 0x8000u) return HybridTimestamp{physical + 1, 0};
+    return HybridTimestamp{physical, logical.value()};
+}
+
+/**
+ * @brief  Latest timestamp
+ */
+template <class Clock>
+HybridTimestamp HybridLogicalClock<Clock>::last(void) const {
+    return HybridTimestamp::unpack(state.load(std::memory_order_acquire));
+}
+
+#endif // __AVR__
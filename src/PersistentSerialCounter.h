@@ -0,0 +1,97 @@
+/**
+ @file    PersistentSerialCounter.h
+ @brief   Header file for PersistentSerialCounter class
+ @author  SerialNumber contributors
+ @version 1.2.0
+ @date    2026-10-16
+ @section license_persistentserialcounter_h License
+  
+ The MIT Licence (MIT)
+ 
+ Copyright (c) 2026 SerialNumber contributors
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+*/
+
+/*
+A PersistentSerialCounter hands out SerialNumbers which are never reused,
+not even after a reset, power loss or crash. Instead of persisting every
+single increment, it reserves blocks of SerialNumbers: Before the first
+SerialNumber of a block is handed out, the end of the block (the 
+"high-water mark") is written to persistent storage. The SerialNumbers of
+the block are then handed out from memory. After a restart, the counter
+resumes at the persisted high-water mark. SerialNumbers which were 
+reserved but not handed out before the restart are skipped.
+
+The storage is accessed through a class S which has to provide two slots
+for values of type T:
+
+    bool load(uint8_t slot, T& value);  // slot 0 or 1, return false if
+                                        // the slot holds no valid value
+    void store(uint8_t slot, T value);  // must be durable on return
+
+The high-water mark is written to both slots alternately. When loading, 
+the larger value of the valid slots according to RFC1982 is used. Thus,
+a write which was interrupted by a crash (and left its slot invalid) 
+never loses the previous high-water mark. Detecting an invalid slot, 
+e.g. via a checksum, is up to S. On Arduino, S will typically wrap 
+EEPROM.get()/EEPROM.put(), on other platforms a file or a memory mapped 
+region which is synced in store().
+
+The block size must be smaller than 2^(SERIAL_BITS - 1), otherwise the
+two slots can not be ordered. Larger values are reduced accordingly.
+*/
+
+#ifndef PersistentSerialCounter_h
+#define PersistentSerialCounter_h
+
+#include "SerialNumber.h"
+
+/* Declaration of the PersistentSerialCounter class template */
+
+template <class T, class S>
+class PersistentSerialCounter {
+    public:
+        // constructor
+        PersistentSerialCounter(S& storage, T block=T(64)); ///< constructor
+
+        // load high-water mark from storage, use initial if there is none
+        void begin(T initial=T(0));
+
+        // hand out the next SerialNumber, reserve a new block if necessary
+        SerialNumber<T> next(void);
+
+        // peek at the SerialNumber which will be handed out next
+        SerialNumber<T> peek(void) const;
+
+        // end of the currently reserved block
+        SerialNumber<T> reserved(void) const;
+
+    private:
+        void reserve(void);
+
+        S& s;
+        T blk;
+        SerialNumber<T> cur;
+        SerialNumber<T> hwm;
+        uint8_t slot;
+};
+
+#include "PersistentSerialCounterClass.hpp"
+
+#endif // PersistentSerialCounter_h
@@ -0,0 +1,124 @@
+/**
+ @file    PersistentSerialCounterClass.hpp
+ @brief   Implementation file for PersistentSerialCounter class
+ @author  SerialNumber contributors
+ @version 1.2.0
+ @date    2026-10-16
+ @section license_persistentserialcounter_class_hpp License
+  
+ The MIT Licence (MIT)
+ 
+ Copyright (c) 2026 SerialNumber contributors
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+*/
+
+/**
+ * @brief  Constructor
+ * @param  storage  persistent storage with two slots
+ * @param  block    number of SerialNumbers to reserve at once
+ * @note   Call begin() before handing out any SerialNumbers.
+ */
+template <class T, class S>
+PersistentSerialCounter<T, S>::PersistentSerialCounter(S& storage, T block) : 
+    s{storage}, 
+    blk{block}, 
+    cur{T(0)}, 
+    hwm{T(0)}, 
+    slot{0} {
+    constexpr T maxblock = static_cast<T>((static_cast<T>(1) << ((sizeof(T) * 8) - 1)) - 1);
+    if (blk == 0) blk = 1;
+    if (blk > maxblock) blk = maxblock;
+}
+
+/**
+ * @brief  Load high-water mark from persistent storage
+ * @param  initial  first SerialNumber if storage holds no valid value
+ * @note   Nothing is written here. The first block is reserved on the 
+ *         first call to next().
+ */
+template <class T, class S>
+void PersistentSerialCounter<T, S>::begin(T initial) {
+    T v0{0};
+    T v1{0};
+    const bool valid0 = s.load(0, v0);
+    const bool valid1 = s.load(1, v1);
+    if (valid0 && valid1) {
+        // resume at the larger one, overwrite the smaller one next time
+        if (SerialNumber<T>{v1} > SerialNumber<T>{v0}) {
+            cur = v1;
+            slot = 0;
+        }
+        else {
+            cur = v0;
+            slot = 1;
+        }
+    }
+    else if (valid0) {
+        cur = v0;
+        slot = 1;
+    }
+    else if (valid1) {
+        cur = v1;
+        slot = 0;
+    }
+    else {
+        cur = initial;
+        slot = 0;
+    }
+    hwm = cur;
+}
+
+/**
+ * @brief  Hand out the next SerialNumber
+ * @return A SerialNumber which has never been handed out before
+ * @note   Writes to persistent storage once every block SerialNumbers.
+ */
+template <class T, class S>
+SerialNumber<T> PersistentSerialCounter<T, S>::next(void) {
+    if (cur == hwm) reserve();
+    return cur++;
+}
+
+/**
+ * @brief  Peek at the SerialNumber which will be handed out next
+ */
+template <class T, class S>
+SerialNumber<T> PersistentSerialCounter<T, S>::peek(void) const {
+    return cur;
+}
+
+/**
+ * @brief  End of the currently reserved block
+ * @return The persisted high-water mark, i.e. the value the counter 
+ *         resumes at after a restart
+ */
+template <class T, class S>
+SerialNumber<T> PersistentSerialCounter<T, S>::reserved(void) const {
+    return hwm;
+}
+
+/**
+ * @brief  Reserve a new block and write its end to persistent storage
+ */
+template <class T, class S>
+void PersistentSerialCounter<T, S>::reserve(void) {
+    hwm = static_cast<T>(cur.value() + blk);
+    s.store(slot, hwm.value());
+    slot ^= 1;
+}
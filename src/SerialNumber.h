@@ -2,8 +2,8 @@
  @file    SerialNumber.h
  @brief   Header file for SerialNumber class (RFC1982)
  @author  Andreas Grommek
- @version 1.1.0
- @date    2021-10-10
+ @version 1.2.0
+ @date    2026-10-16
  @section license_serialnumber_h License
   
  The MIT Licence (MIT)
@@ -114,9 +114,9 @@
  
  It is even possible to compare SerialNumber objects to negative numbers
  or floating point numbers. This is not really useful, but at least
- generates no compiler error. However, comparing to negative floating
- point numbers does generate a compiler error due to the 'only one 
- implicit conversion' rule.
+ generates no compiler error (most compilers do warn, though). Note that
+ converting negative floating point numbers to an unsigned type is 
+ undefined behavior.
  To be on the safe side (and prevent yourself shooting in  the foot), 
  either only use numbers of the correct data type for comparons to 
  SerialNumber object or use an explicit cast.
@@ -132,6 +132,28 @@
                                      // result in hard to debug bugs
  @endverbatim
  
+ @subsection strict_mode Strict mode
+ 
+ Define the macro <tt>SERIALNUMBER_STRICT</tt> before including 
+ SerialNumber.h to turn the implicit conversions described above into
+ compiler errors. In strict mode, SerialNumber objects can only be 
+ compared to other SerialNumber objects of the same type and to plain 
+ numbers of @b exactly the underlying data type:
+ 
+ @verbatim
+ #define SERIALNUMBER_STRICT
+ #include <SerialNumber.h>
+
+ SerialNumber<uint16_t> sn16{65000};
+ uint16_t c16 = 17000;
+ uint32_t c32 = 17000;
+
+ sn16 == c16;                        // good, same data type (uint16_t)
+ sn16 == static_cast<uint16_t>(c32); // good, make your intent explicit
+ sn16 == c32;                        // compiler error
+ sn16 == 17000;                      // compiler error, 17000 is an int
+ @endverbatim
+ 
  @section examples Examples
 
  @subsection example0 A trivial example
@@ -289,7 +311,9 @@
  
  @section author Author
 
- Andreas Grommek
+ Andreas Grommek (SerialNumber class)
+
+ SerialNumber contributors (extensions added in version 1.2.0)
 
  @section license License
  
@@ -314,13 +338,78 @@
  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
  SOFTWARE.
 
- @version  1.1.0
- @date     2021-10-10
+ @version  1.2.0
+ @date     2026-10-16
 */
 
 #ifndef SerialNumber_h
 #define SerialNumber_h
 
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+Hooks for optional instrumentation, see SerialNumberStats.h. Without the 
+macro SERIALNUMBER_INSTRUMENTATION, the hooks compile to nothing.
+*/
+#ifdef SERIALNUMBER_INSTRUMENTATION
+#include "SerialNumberStats.h"
+#define SERIALNUMBER_COUNT_COMPARISON(T, i1, i2) SerialNumberStats<T>::count_comparison(i1, i2)
+#define SERIALNUMBER_COUNT_INCREMENT(T, n) SerialNumberStats<T>::count_increment(n)
+#else
+#define SERIALNUMBER_COUNT_COMPARISON(T, i1, i2) ((void)0)
+#define SERIALNUMBER_COUNT_INCREMENT(T, n) ((void)0)
+#endif
+
+/*
+The ordering operators are implemented on top of two "kernels" which work
+on plain values of the underlying data type. Both only look at the 
+distance d = i2 - i1 (modulo 2^SERIAL_BITS):
+
+    i1 < i2  if and only if  0 < d < 2^(SERIAL_BITS - 1)
+    i1 > i2  if and only if  d > 2^(SERIAL_BITS - 1)
+
+For uint8_t, there are only 256 possible distances. Optionally, the 
+kernels for uint8_t can be replaced by a lookup in two bit-packed tables
+of 32 bytes each (generated at compile time and stored in PROGMEM on AVR).
+To enable table lookups in the comparison operators, define the macro 
+SERIALNUMBER_UINT8_TABLE before including this file. The table-based 
+kernels are always available under their own names, regardless of the
+macro.
+*/
+
+/* Declaration of comparison kernels */
+
+// "lower than" kernel
+template <class T>
+bool serialnumber_less(T i1, T i2);
+
+// "greater than" kernel
+template <class T>
+bool serialnumber_greater(T i1, T i2);
+
+#ifdef UINT8_MAX
+// "lower than" kernel for uint8_t, using a lookup table
+inline bool serialnumber_less_table(uint8_t i1, uint8_t i2);
+
+// "greater than" kernel for uint8_t, using a lookup table
+inline bool serialnumber_greater_table(uint8_t i1, uint8_t i2);
+#endif
+
+/*
+The comparison operators are defined as friends inside the class. Thus, 
+they are non-template functions which are only found via argument-dependent
+lookup, i.e. only if at least one operand is a SerialNumber. Comparing a
+SerialNumber to a plain number works via the (implicit) constructor:
+
+    bool operatorX (SerialNumber<T>, SerialNumber<T>)
+    bool operatorX (T              , SerialNumber<T>)  --> T converted to SerialNumber<T>
+    bool operatorX (SerialNumber<T>, T)                --> T converted to SerialNumber<T>
+
+Comparing two SerialNumber objects with different data types is not supported.
+*/
+
 /* Declaration of the SerialName class template */
 
 template <class T>
@@ -339,7 +428,8 @@ class SerialNumber {
         SerialNumber& operator= (T sn);
         
         // assignment operator for SerialNumbers
-        SerialNumber& operator= (const SerialNumber<T>& sn);
+        // (defaulted, keeps SerialNumber trivially copyable, e.g. for std::atomic)
+        SerialNumber& operator= (const SerialNumber<T>& sn) = default; ///< Copy assignment operator
 
         // prefix increment operator (no parameters)
         SerialNumber& operator++ ();
@@ -347,6 +437,134 @@ class SerialNumber {
         // postfix increment operator (one int parameter)
         SerialNumber operator++ (int);
 
+        // equality operator
+        friend bool operator== (const SerialNumber& sn1, const SerialNumber& sn2) {
+            return sn1.n == sn2.n;
+        }
+
+        // inequality operator
+        friend bool operator!= (const SerialNumber& sn1, const SerialNumber& sn2) {
+            return sn1.n != sn2.n;
+        }
+
+        // lower-than operator
+        friend bool operator< (const SerialNumber& sn1, const SerialNumber& sn2) {
+            return serialnumber_less(sn1.n, sn2.n);
+        }
+
+        // greater-than operator
+        friend bool operator> (const SerialNumber& sn1, const SerialNumber& sn2) {
+            return serialnumber_greater(sn1.n, sn2.n);
+        }
+
+        // lower-or-equal operator
+        friend bool operator<= (const SerialNumber& sn1, const SerialNumber& sn2) {
+            return (sn1 == sn2) || (sn1 < sn2);
+        }
+
+        // greater-or-equal operator
+        friend bool operator>= (const SerialNumber& sn1, const SerialNumber& sn2) {
+            return (sn1 == sn2) || (sn1 > sn2);
+        }
+
+#ifdef SERIALNUMBER_STRICT
+        /*
+        Strict mode: comparisons to plain numbers only compile if the number
+        has exactly type T. For all other types, the deleted templates below
+        are a better match than the conversion via the constructor.
+        */
+
+        // equality operator (strict mode)
+        friend bool operator== (const SerialNumber& sn1, T sn2) {
+            return sn1.n == sn2;
+        }
+
+        friend bool operator== (T sn1, const SerialNumber& sn2) {
+            return sn1 == sn2.n;
+        }
+
+        template <class U>
+        friend bool operator== (const SerialNumber& sn1, const U& sn2) = delete;
+
+        template <class U>
+        friend bool operator== (const U& sn1, const SerialNumber& sn2) = delete;
+
+        // inequality operator (strict mode)
+        friend bool operator!= (const SerialNumber& sn1, T sn2) {
+            return sn1.n != sn2;
+        }
+
+        friend bool operator!= (T sn1, const SerialNumber& sn2) {
+            return sn1 != sn2.n;
+        }
+
+        template <class U>
+        friend bool operator!= (const SerialNumber& sn1, const U& sn2) = delete;
+
+        template <class U>
+        friend bool operator!= (const U& sn1, const SerialNumber& sn2) = delete;
+
+        // lower-than operator (strict mode)
+        friend bool operator<  (const SerialNumber& sn1, T sn2) {
+            return serialnumber_less(sn1.n, sn2);
+        }
+
+        friend bool operator<  (T sn1, const SerialNumber& sn2) {
+            return serialnumber_less(sn1, sn2.n);
+        }
+
+        template <class U>
+        friend bool operator<  (const SerialNumber& sn1, const U& sn2) = delete;
+
+        template <class U>
+        friend bool operator<  (const U& sn1, const SerialNumber& sn2) = delete;
+
+        // greater-than operator (strict mode)
+        friend bool operator>  (const SerialNumber& sn1, T sn2) {
+            return serialnumber_greater(sn1.n, sn2);
+        }
+
+        friend bool operator>  (T sn1, const SerialNumber& sn2) {
+            return serialnumber_greater(sn1, sn2.n);
+        }
+
+        template <class U>
+        friend bool operator>  (const SerialNumber& sn1, const U& sn2) = delete;
+
+        template <class U>
+        friend bool operator>  (const U& sn1, const SerialNumber& sn2) = delete;
+
+        // lower-or-equal operator (strict mode)
+        friend bool operator<= (const SerialNumber& sn1, T sn2) {
+            return (sn1 == sn2) || (sn1 < sn2);
+        }
+
+        friend bool operator<= (T sn1, const SerialNumber& sn2) {
+            return (sn1 == sn2) || (sn1 < sn2);
+        }
+
+        template <class U>
+        friend bool operator<= (const SerialNumber& sn1, const U& sn2) = delete;
+
+        template <class U>
+        friend bool operator<= (const U& sn1, const SerialNumber& sn2) = delete;
+
+        // greater-or-equal operator (strict mode)
+        friend bool operator>= (const SerialNumber& sn1, T sn2) {
+            return (sn1 == sn2) || (sn1 > sn2);
+        }
+
+        friend bool operator>= (T sn1, const SerialNumber& sn2) {
+            return (sn1 == sn2) || (sn1 > sn2);
+        }
+
+        template <class U>
+        friend bool operator>= (const SerialNumber& sn1, const U& sn2) = delete;
+
+        template <class U>
+        friend bool operator>= (const U& sn1, const SerialNumber& sn2) = delete;
+#endif // SERIALNUMBER_STRICT
+
     private:
         T n;
 };
@@ -354,76 +572,94 @@ class SerialNumber {
 #include "SerialNumberClass.hpp"
 
 /*
-There are three overloads for each comparison operator:
-
-    bool operatorX (SerialNumber<T>, SerialNumber<T>)
-    bool operatorX (T              , SerialNumber<T>)
-    bool operatorX (SerialNumber<T>, T)
+Policies for the critical distance of exactly 2^(SERIAL_BITS - 1).
 
-Comparing two SerialNumber objects with different data types is not supported.
-*/
+RFC1982 leaves the result of ordering two SerialNumbers with this distance
+undefined. The comparison operators always return false in this case. If
+this is not what you need, use serialnumber_less() and 
+serialnumber_greater() on SerialNumber objects with one of the following 
+policies as template parameter:
 
-/* Declaration of comparison operators for SerialNumber objects */
+    SerialNumberTieFalse    both "lower than" and "greater than" return
+                            false (same as the operators)
+    SerialNumberTieLess     the first argument is considered lower
+    SerialNumberTieGreater  the first argument is considered greater
+    SerialNumberTieAssert   like SerialNumberTieFalse, but fail an assert()
 
-// equality operator
-template <class T, class U>
-bool operator== (const SerialNumber<T>& sn1, const SerialNumber<T>& sn2);
+Alternatively, pass a bool reference as third parameter to learn whether 
+the arguments had the critical distance.
 
-template <class T, class U>
-bool operator== (const SerialNumber<T>& sn1, U sn2);
+The tie is resolved inside the kernel without any additional branches. 
+Thus, there is no need to check for "!=" and do a second comparison.
+*/
 
-template <class T, class U>
-bool operator== (T sn1, const SerialNumber<U>& sn2);
+/* Declaration of policies for the critical distance */
 
-// inequality operator
-template <class T, class U>
-bool operator!= (const SerialNumber<T>& sn1, const SerialNumber<T>& sn2);
+struct SerialNumberTieFalse {
+    static constexpr bool tie_less = false;    ///< result of "lower than" at critical distance
+    static constexpr bool tie_greater = false; ///< result of "greater than" at critical distance
+    static void check(bool tie) { (void)tie; } ///< hook called with the tie flag
+};
 
-template <class T, class U>
-bool operator!= (const SerialNumber<T>& sn1, U sn2);
+struct SerialNumberTieLess {
+    static constexpr bool tie_less = true;     ///< result of "lower than" at critical distance
+    static constexpr bool tie_greater = false; ///< result of "greater than" at critical distance
+    static void check(bool tie) { (void)tie; } ///< hook called with the tie flag
+};
 
-template <class T, class U> 
-bool operator!= (T sn1, const SerialNumber<U>& sn2);
+struct SerialNumberTieGreater {
+    static constexpr bool tie_less = false;    ///< result of "lower than" at critical distance
+    static constexpr bool tie_greater = true;  ///< result of "greater than" at critical distance
+    static void check(bool tie) { (void)tie; } ///< hook called with the tie flag
+};
 
-// lower-than operator
-template <class T, class U>
-bool operator< (const SerialNumber<T>& sn1, const SerialNumber<T>& sn2);
+struct SerialNumberTieAssert {
+    static constexpr bool tie_less = false;    ///< result of "lower than" at critical distance
+    static constexpr bool tie_greater = false; ///< result of "greater than" at critical distance
+    static void check(bool tie) { assert(!tie); (void)tie; } ///< hook called with the tie flag
+};
 
-template <class T, class U>
-bool operator< (const SerialNumber<T>& sn1, U sn2);
+/* Declaration of comparison functions with policy for the critical distance */
 
-template <class T, class U>
-bool operator< (T sn1, const SerialNumber<U>& sn2);
+// "lower than" with policy
+template <class P=SerialNumberTieFalse, class T>
+bool serialnumber_less(const SerialNumber<T>& sn1, const SerialNumber<T>& sn2);
 
-// greater-than operator
-template <class T, class U>
-bool operator> (const SerialNumber<T>& sn1, const SerialNumber<T>& sn2);
+// "greater than" with policy
+template <class P=SerialNumberTieFalse, class T>
+bool serialnumber_greater(const SerialNumber<T>& sn1, const SerialNumber<T>& sn2);
 
-template <class T, class U>
-bool operator> (const SerialNumber<T>& sn1, U sn2);
+// "lower than", reporting the critical distance via out-parameter
+template <class T>
+bool serialnumber_less(const SerialNumber<T>& sn1, const SerialNumber<T>& sn2, bool& tie);
 
-template <class T, class U>
-bool operator> (T sn1, const SerialNumber<U>& sn2);
+// "greater than", reporting the critical distance via out-parameter
+template <class T>
+bool serialnumber_greater(const SerialNumber<T>& sn1, const SerialNumber<T>& sn2, bool& tie);
 
-// lower-or-equal operator
-template <class T, class U>
-bool operator<= (const SerialNumber<T>& sn1, const SerialNumber<T>& sn2);
+/*
+Window test, e.g. for checking a TCP segment against the receive window
+[RCV.NXT, RCV.NXT + RCV.WND).
 
-template <class T, class U>
-bool operator<= (const SerialNumber<T>& sn1, U sn2);
+A SerialNumber sn is within the window of len SerialNumbers starting at 
+start if and only if (sn - start) mod 2^SERIAL_BITS < len. This takes a 
+single subtraction and a single comparison, instead of two comparisons 
+and an addition (which is not defined for SerialNumbers). The window may 
+be larger than 2^(SERIAL_BITS - 1).
 
-template <class T, class U>
-bool operator<= (T sn1, const SerialNumber<U>& sn2);
+The variant for arrays has no data-dependent branches, so the compiler 
+can vectorize it.
+*/
 
-// greater-or-equal operator
-template <class T, class U>
-bool operator>= (const SerialNumber<T>& sn1, const SerialNumber<T>& sn2);
+/* Declaration of window test functions */
 
-template <class T, class U>
-bool operator>= (const SerialNumber<T>& sn1, U sn2);
+// true if sn is within [start, start + len)
+template <class T>
+bool in_window(const SerialNumber<T>& sn, const SerialNumber<T>& start, T len);
 
-template <class T, class U>
-bool operator>= (T sn1, const SerialNumber<U>& sn2);
+// window test for n values, store 0 or 1 in result, return number within window
+template <class T>
+size_t in_window(const T* sn, size_t n, const SerialNumber<T>& start, T len, uint8_t* result);
 
 #include "SerialNumberOperators.hpp"
 
@@ -0,0 +1,111 @@
+/**
+ @file    SerialNumberAtomic.h
+ @brief   Header file for atomic maximum and minimum of SerialNumbers
+ @author  SerialNumber contributors
+ @version 1.2.0
+ @date    2026-10-16
+ @section license_serialnumberatomic_h License
+  
+ The MIT Licence (MIT)
+ 
+ Copyright (c) 2026 SerialNumber contributors
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+*/
+
+/*
+atomic_serial_max() and atomic_serial_min() update an atomic SerialNumber
+shared by many threads, e.g. the highest acknowledged SerialNumber. The 
+new value is only written if it is strictly greater (or lower) than the 
+current one according to RFC1982. The update is lock-free: a 
+compare-and-swap loop which ends as soon as the new value is stored, or 
+the current value is not lower (greater) any more. A successful update 
+has release semantics.
+
+Under extreme contention, all threads hammer the same cache line. 
+ShardedSerialMax<T, S> spreads the updates over S atomic SerialNumbers 
+on separate cache lines. Each thread updates the shard selected by a hint 
+(e.g. its thread index). get() combines all shards, so reading is more 
+expensive than updating.
+
+A shard which is left idle would eventually be more than 
+2^(SERIAL_BITS - 1) behind the others, and plain RFC1982 comparisons 
+would then consider it newer. Therefore, shards are compared relative to
+a common base, the value combined by the last call of get(): a shard 
+behind the base is stale: get() ignores it and lifts it to the new 
+maximum, and update() overwrites it. Thus, no shard falls more than 
+2^(SERIAL_BITS - 1) behind the base. This works as long as the maximum 
+advances by less than 2^(SERIAL_BITS - 1) between two calls of get(); 
+update() rejects values which are that far ahead of the base.
+
+This header requires <atomic> and is thus not available on AVR.
+*/
+
+#ifndef SerialNumberAtomic_h
+#define SerialNumberAtomic_h
+
+#include <atomic>
+#include <stddef.h>
+#include "SerialNumber.h"
+
+/* Declaration of atomic maximum and minimum functions */
+
+// store sn in a if sn is greater than a, return true if stored
+template <class T>
+bool atomic_serial_max(std::atomic<SerialNumber<T> >& a, const SerialNumber<T>& sn);
+
+// store sn in a if sn is lower than a, return true if stored
+template <class T>
+bool atomic_serial_min(std::atomic<SerialNumber<T> >& a, const SerialNumber<T>& sn);
+
+/* Declaration of the ShardedSerialMax class template */
+
+template <class T, size_t S=16>
+class ShardedSerialMax {
+    public:
+        // constructor
+        ShardedSerialMax(const SerialNumber<T>& initial=SerialNumber<T>{0}); ///< constructor
+
+        // not copyable
+        ShardedSerialMax(const ShardedSerialMax&) = delete;            ///< not copyable
+        ShardedSerialMax& operator= (const ShardedSerialMax&) = delete; ///< not copyable
+
+        // store sn in shard (hint % S) if greater, return true if stored
+        bool update(size_t hint, const SerialNumber<T>& sn);
+
+        // maximum over all shards, refreshes stale shards
+        SerialNumber<T> get(void);
+
+    private:
+        static constexpr size_t line = 64;
+        static constexpr T half = static_cast<T>(T(1) << (sizeof(T) * 8 - 1));
+
+        struct Shard {
+            alignas(line) std::atomic<SerialNumber<T> > v;
+        };
+
+        // distance of sn from base b (at least half if sn is behind b)
+        static T offset(const SerialNumber<T>& sn, const SerialNumber<T>& b);
+
+        Shard base; // value combined by the last call of get()
+        Shard shards[S];
+};
+
+#include "SerialNumberAtomicFunctions.hpp"
+
+#endif // SerialNumberAtomic_h
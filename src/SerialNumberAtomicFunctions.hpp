@@ -0,0 +1,127 @@
+/**
+ @file    SerialNumberAtomicFunctions.hpp
+ @brief   Implementation file for atomic maximum and minimum of SerialNumbers
+ @author  SerialNumber contributors
+ @version 1.2.0
+ @date    2026-10-16
+ @section license_serialnumberatomic_functions_hpp License
+  
+ The MIT Licence (MIT)
+ 
+ Copyright (c) 2026 SerialNumber contributors
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+*/
+
+/**
+ * @brief  Atomic maximum
+ * @param  a   atomic SerialNumber to update
+ * @param  sn  new value
+ * @return true if sn was stored, false if a was not lower than sn
+ */
+template <class T>
+bool atomic_serial_max(std::atomic<SerialNumber<T> >& a, const SerialNumber<T>& sn) {
+    SerialNumber<T> cur = a.load(std::memory_order_relaxed);
+    while (sn > cur) {
+        if (a.compare_exchange_weak(cur, sn, std::memory_order_release, std::memory_order_relaxed)) return true;
+    }
+    return false;
+}
+
+/**
+ * @brief  Atomic minimum
+ * @param  a   atomic SerialNumber to update
+ * @param  sn  new value
+ * @return true if sn was stored, false if a was not greater than sn
+ */
+template <class T>
+bool atomic_serial_min(std::atomic<SerialNumber<T> >& a, const SerialNumber<T>& sn) {
+    SerialNumber<T> cur = a.load(std::memory_order_relaxed);
+    while (sn < cur) {
+        if (a.compare_exchange_weak(cur, sn, std::memory_order_release, std::memory_order_relaxed)) return true;
+    }
+    return false;
+}
+
+/**
+ * @brief  Constructor
+ * @param  initial  initial value of all shards
+ */
+template <class T, size_t S>
+ShardedSerialMax<T, S>::ShardedSerialMax(const SerialNumber<T>& initial) {
+    static_assert(S >= 1, "S must be at least 1");
+    base.v.store(initial, std::memory_order_relaxed);
+    for (size_t i=0; i<S; i++) shards[i].v.store(initial, std::memory_order_relaxed);
+}
+
+/**
+ * @brief  Distance of sn from base b
+ * @return sn - b, at least 2^(SERIAL_BITS - 1) if sn is behind b
+ */
+template <class T, size_t S>
+T ShardedSerialMax<T, S>::offset(const SerialNumber<T>& sn, const SerialNumber<T>& b) {
+    return static_cast<T>(sn.value() - b.value());
+}
+
+/**
+ * @brief  Update a shard
+ * @param  hint  selects the shard (hint % S), e.g. the thread index
+ * @param  sn    new value
+ * @return true if sn was stored, false if the shard was not lower than sn
+ *         or sn is not within 2^(SERIAL_BITS - 1) - 1 after the value 
+ *         combined by the last call of get()
+ * @note   A stale shard (behind that value) accepts any sn in range.
+ */
+template <class T, size_t S>
+bool ShardedSerialMax<T, S>::update(size_t hint, const SerialNumber<T>& sn) {
+    std::atomic<SerialNumber<T> >& a = shards[hint % S].v;
+    const SerialNumber<T> b = base.v.load(std::memory_order_acquire);
+    const T d = offset(sn, b);
+    if (d >= half) return false;
+    SerialNumber<T> cur = a.load(std::memory_order_relaxed);
+    while ((offset(cur, b) >= half) || (d > offset(cur, b))) {
+        if (a.compare_exchange_weak(cur, sn, std::memory_order_release, std::memory_order_relaxed)) return true;
+    }
+    return false;
+}
+
+/**
+ * @brief  Maximum over all shards
+ * @note   Shards behind the value combined by the previous call are 
+ *         stale. They are ignored and lifted to the new maximum.
+ */
+template <class T, size_t S>
+SerialNumber<T> ShardedSerialMax<T, S>::get(void) {
+    const SerialNumber<T> b = base.v.load(std::memory_order_acquire);
+    T best = 0;
+    for (size_t i=0; i<S; i++) {
+        const T d = offset(shards[i].v.load(std::memory_order_acquire), b);
+        if ((d < half) && (d > best)) best = d;
+    }
+    const SerialNumber<T> m{static_cast<T>(b.value() + best)};
+    atomic_serial_max(base.v, m);
+
+    // lift stale shards, so that they never fall too far behind the base
+    for (size_t i=0; i<S; i++) {
+        SerialNumber<T> cur = shards[i].v.load(std::memory_order_relaxed);
+        while (offset(cur, b) >= half) {
+            if (shards[i].v.compare_exchange_weak(cur, m, std::memory_order_release, std::memory_order_relaxed)) break;
+        }
+    }
+    return m;
+}
@@ -2,8 +2,8 @@
  @file    SerialNumberClass.hpp
  @brief   Implementation file for SerialNumber class (RFC1982)
  @author  Andreas Grommek
- @version 1.1.0
- @date    2021-10-10
+ @version 1.2.0
+ @date    2026-10-16
  @section license_serialnumber_class_hpp License
   
  The MIT Licence (MIT)
@@ -52,27 +52,27 @@ specialization for the constructor, like so:
 */
 #ifdef UINT8_MAX
 template<>
-SerialNumber<uint8_t>::SerialNumber(uint8_t sn) : n{sn} {}
+inline SerialNumber<uint8_t>::SerialNumber(uint8_t sn) : n{sn} {}
 #endif
 
 #ifdef UINT16_MAX
 template<>
-SerialNumber<uint16_t>::SerialNumber(uint16_t sn) : n{sn} {}
+inline SerialNumber<uint16_t>::SerialNumber(uint16_t sn) : n{sn} {}
 #endif
 
 #ifdef UINT32_MAX
 template<>
-SerialNumber<uint32_t>::SerialNumber(uint32_t sn) : n{sn} {}
+inline SerialNumber<uint32_t>::SerialNumber(uint32_t sn) : n{sn} {}
 #endif
 
 #ifdef UINT64_MAX
 template<>
-SerialNumber<uint64_t>::SerialNumber(uint64_t sn) : n{sn} {}
+inline SerialNumber<uint64_t>::SerialNumber(uint64_t sn) : n{sn} {}
 #endif
 
 #ifdef UINT128_MAX
 template<>
-SerialNumber<uint128_t>::SerialNumber(uint128_t sn) : n{sn} {}
+inline SerialNumber<uint128_t>::SerialNumber(uint128_t sn) : n{sn} {}
 #endif
 
 /**
@@ -96,21 +96,13 @@ SerialNumber<T>& SerialNumber<T>::operator= (T sn) {
     return *this;
 }
 
-/**
- * @brief  Assignment operator for SerialNumbers
- */
-template <class T>
-SerialNumber<T>& SerialNumber<T>::operator= (const SerialNumber<T>& sn) {
-    n = sn.n;
-    return *this;
-}
-
 /**
  * @brief  Prefix increment operator
  */
 template <class T>
 SerialNumber<T>& SerialNumber<T>::operator++ () {
     ++n;
+    SERIALNUMBER_COUNT_INCREMENT(T, n);
     return *this;
 }
 
@@ -121,5 +113,6 @@ template <class T>
 SerialNumber<T> SerialNumber<T>::operator++ (int) {
     SerialNumber temp{n};
     ++n;
+    SERIALNUMBER_COUNT_INCREMENT(T, n);
     return temp;
 }
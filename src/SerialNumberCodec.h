@@ -0,0 +1,126 @@
+/**
+ @file    SerialNumberCodec.h
+ @brief   Header file for encoding and decoding SerialNumbers
+ @author  SerialNumber contributors
+ @version 1.2.0
+ @date    2026-10-16
+ @section license_serialnumber_codec_h License
+  
+ The MIT Licence (MIT)
+ 
+ Copyright (c) 2026 SerialNumber contributors
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+*/
+
+/*
+Building blocks for compact encodings of SerialNumbers.
+
+Consecutive SerialNumbers are usually close to each other. Instead of the
+SerialNumbers themselves, it is cheaper to store the (signed) distance to
+a reference, e.g. the previous SerialNumber. The distance is computed 
+modulo 2^SERIAL_BITS, so wrapping around costs nothing: the distance from
+65535 to 0 is +1 for SerialNumber<uint16_t>.
+
+serialnumber_zigzag() maps the signed distance to an unsigned number, so 
+that small positive and small negative distances both result in small
+numbers (0, -1, +1, -2, +2, ... --> 0, 1, 2, 3, 4, ...). 
+serialnumber_unzigzag() is its inverse.
+
+varint_encode() writes an unsigned number with 7 bits per byte, least
+significant group first. The most significant bit of each byte is set if
+more bytes follow. Numbers below 128 thus take a single byte.
+
+serialnumber_encode() and serialnumber_decode() encode lists of 
+SerialNumbers, e.g. acknowledgement lists, for transmission. Each 
+SerialNumber is encoded as the zigzag encoded distance to its predecessor
+(the first one as the distance to a reference known to both sides) and 
+written as varint. 
+
+serialnumber_encode_group() and serialnumber_decode_group() use the same
+distances, but write them in groups of four with a common control byte 
+("group varint"). The control byte holds the number of bytes (1..4) of 
+each of the four distances, two bits each, lowest bits first. This is
+faster to decode than plain varints, as there is only a single branch per
+group of four, but is only available for types with at most 32 bits.
+
+The decoded SerialNumbers are identical to the encoded ones, including
+wrap-arounds. The decoders only accept the canonical encodings written by
+the encoders and reject overlong varints, bits beyond the width of T,
+zero high bytes in group varints and stray bits in control bytes. Thus,
+every list of SerialNumbers has exactly one valid encoding.
+*/
+
+#ifndef SerialNumberCodec_h
+#define SerialNumberCodec_h
+
+#include "SerialNumber.h"
+
+/* Declaration of zigzag functions */
+
+// zigzag encoded distance from reference to sn
+template <class T>
+T serialnumber_zigzag(const SerialNumber<T>& reference, const SerialNumber<T>& sn);
+
+// SerialNumber with zigzag encoded distance zz from reference
+template <class T>
+SerialNumber<T> serialnumber_unzigzag(const SerialNumber<T>& reference, T zz);
+
+/* Declaration of varint functions */
+
+// maximum number of bytes of a varint of type T
+template <class T>
+constexpr size_t varint_max_size(void);
+
+// write value as varint to out, return number of bytes written
+template <class T>
+size_t varint_encode(T value, uint8_t* out);
+
+// read canonical varint from in (at most len bytes), return number of bytes read or 0 on error
+template <class T>
+size_t varint_decode(const uint8_t* in, size_t len, T& value);
+
+/* Declaration of list encoding functions */
+
+// maximum number of bytes of count SerialNumbers encoded with serialnumber_encode()
+template <class T>
+constexpr size_t serialnumber_encode_max_size(size_t count);
+
+// encode count SerialNumbers as varints, return number of bytes written or 0 on error
+template <class T>
+size_t serialnumber_encode(const SerialNumber<T>& reference, const SerialNumber<T>* sns, size_t count, uint8_t* out, size_t len);
+
+// decode count SerialNumbers from varints, return number of bytes read or 0 on error
+template <class T>
+size_t serialnumber_decode(const SerialNumber<T>& reference, const uint8_t* in, size_t len, SerialNumber<T>* sns, size_t count);
+
+// maximum number of bytes of count SerialNumbers encoded with serialnumber_encode_group()
+template <class T>
+constexpr size_t serialnumber_encode_group_max_size(size_t count);
+
+// encode count SerialNumbers as group varints, return number of bytes written or 0 on error
+template <class T>
+size_t serialnumber_encode_group(const SerialNumber<T>& reference, const SerialNumber<T>* sns, size_t count, uint8_t* out, size_t len);
+
+// decode count SerialNumbers from group varints, return number of bytes read or 0 on error
+template <class T>
+size_t serialnumber_decode_group(const SerialNumber<T>& reference, const uint8_t* in, size_t len, SerialNumber<T>* sns, size_t count);
+
+#include "SerialNumberCodecFunctions.hpp"
+
+#endif // SerialNumberCodec_h
@@ -0,0 +1,252 @@
+/**
+ @file    SerialNumberCodecFunctions.hpp
+ @brief   Implementation file for encoding and decoding SerialNumbers
+ @author  SerialNumber contributors
+ @version 1.2.0
+ @date    2026-10-16
+ @section license_serialnumber_codec_functions_hpp License
+  
+ The MIT Licence (MIT)
+ 
+ Copyright (c) 2026 SerialNumber contributors
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+*/
+
+/**
+ * @brief  Zigzag encoded distance between two SerialNumbers
+ * @param  reference  reference SerialNumber
+ * @param  sn         SerialNumber to encode
+ * @return Distance sn - reference (modulo 2^SERIAL_BITS), zigzag encoded
+ */
+template <class T>
+T serialnumber_zigzag(const SerialNumber<T>& reference, const SerialNumber<T>& sn) {
+    const T d = static_cast<T>(sn.value() - reference.value());
+    const T sign = static_cast<T>(d >> ((sizeof(T) * 8) - 1));
+    return static_cast<T>(static_cast<T>(d << 1) ^ static_cast<T>(T(0) - sign));
+}
+
+/**
+ * @brief  Decode zigzag encoded distance
+ * @param  reference  reference SerialNumber
+ * @param  zz         zigzag encoded distance
+ * @return SerialNumber with distance zz from reference
+ */
+template <class T>
+SerialNumber<T> serialnumber_unzigzag(const SerialNumber<T>& reference, T zz) {
+    const T d = static_cast<T>(static_cast<T>(zz >> 1) ^ static_cast<T>(T(0) - static_cast<T>(zz & 1)));
+    return SerialNumber<T>{static_cast<T>(reference.value() + d)};
+}
+
+/**
+ * @brief  Maximum number of bytes of a varint of type T
+ */
+template <class T>
+constexpr size_t varint_max_size(void) {
+    return (sizeof(T) * 8 + 6) / 7;
+}
+
+/**
+ * @brief  Write value as varint
+ * @param  value  value to write
+ * @param  out    destination, must have room for varint_max_size<T>() bytes
+ * @return Number of bytes written
+ */
+template <class T>
+size_t varint_encode(T value, uint8_t* out) {
+    size_t i = 0;
+    while (value >= 0x80) {
+        out[i++] = static_cast<uint8_t>(value | 0x80);
+        value = static_cast<T>(value >> 7);
+    }
+    out[i++] = static_cast<uint8_t>(value);
+    return i;
+}
+
+/**
+ * @brief  Read varint
+ * @param  in     source
+ * @param  len    number of bytes available at in
+ * @param  value  decoded value
+ * @return Number of bytes read, 0 if the varint is truncated, too long or
+ *         not canonical
+ * @note   Only the encoding written by varint_encode() is accepted: a
+ *         varint of more than one byte must not end with a zero byte
+ *         (overlong), and the last byte must not set bits beyond
+ *         sizeof(T) * 8. Thus, every value has exactly one encoding.
+ */
+template <class T>
+size_t varint_decode(const uint8_t* in, size_t len, T& value) {
+    T v{0};
+    const size_t maxlen = (len < varint_max_size<T>()) ? len : varint_max_size<T>();
+    for (size_t i=0; i<maxlen; i++) {
+        const uint8_t bits = static_cast<uint8_t>(in[i] & 0x7F);
+        // bits beyond the width of T (only possible in the last byte)
+        if ((7 * i + 7 > sizeof(T) * 8) && ((bits >> (sizeof(T) * 8 - 7 * i)) != 0)) return 0;
+        v = static_cast<T>(v | (static_cast<T>(bits) << (7 * i)));
+        if ((in[i] & 0x80) == 0) {
+            if ((i > 0) && (in[i] == 0)) return 0; // overlong
+            value = v;
+            return i + 1;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief  Maximum size of SerialNumbers encoded with serialnumber_encode()
+ * @param  count  number of SerialNumbers
+ * @return Maximum number of bytes
+ */
+template <class T>
+constexpr size_t serialnumber_encode_max_size(size_t count) {
+    return count * varint_max_size<T>();
+}
+
+/**
+ * @brief  Encode SerialNumbers as zigzag encoded varints
+ * @param  reference  reference SerialNumber, must be known to the decoder
+ * @param  sns        SerialNumbers to encode
+ * @param  count      number of SerialNumbers
+ * @param  out        destination
+ * @param  len        size of destination in bytes
+ * @return Number of bytes written, 0 if destination is too small
+ */
+template <class T>
+size_t serialnumber_encode(const SerialNumber<T>& reference, const SerialNumber<T>* sns, size_t count, uint8_t* out, size_t len) {
+    size_t pos = 0;
+    SerialNumber<T> prev = reference;
+    for (size_t i=0; i<count; i++) {
+        uint8_t tmp[varint_max_size<T>()];
+        const size_t n = varint_encode(serialnumber_zigzag(prev, sns[i]), tmp);
+        if (pos + n > len) return 0;
+        for (size_t k=0; k<n; k++) {
+            out[pos + k] = tmp[k];
+        }
+        pos += n;
+        prev = sns[i];
+    }
+    return pos;
+}
+
+/**
+ * @brief  Decode SerialNumbers from zigzag encoded varints
+ * @param  reference  reference SerialNumber used by the encoder
+ * @param  in         source
+ * @param  len        number of bytes available at in
+ * @param  sns        decoded SerialNumbers
+ * @param  count      number of SerialNumbers to decode
+ * @return Number of bytes read, 0 if the input is invalid or truncated
+ */
+template <class T>
+size_t serialnumber_decode(const SerialNumber<T>& reference, const uint8_t* in, size_t len, SerialNumber<T>* sns, size_t count) {
+    size_t pos = 0;
+    SerialNumber<T> prev = reference;
+    for (size_t i=0; i<count; i++) {
+        T zz{0};
+        const size_t n = varint_decode(in + pos, len - pos, zz);
+        if (n == 0) return 0;
+        pos += n;
+        prev = serialnumber_unzigzag(prev, zz);
+        sns[i] = prev;
+    }
+    return pos;
+}
+
+/**
+ * @brief  Maximum size of SerialNumbers encoded with serialnumber_encode_group()
+ * @param  count  number of SerialNumbers
+ * @return Maximum number of bytes
+ */
+template <class T>
+constexpr size_t serialnumber_encode_group_max_size(size_t count) {
+    return count * sizeof(T) + (count + 3) / 4;
+}
+
+/**
+ * @brief  Encode SerialNumbers as zigzag encoded group varints
+ * @param  reference  reference SerialNumber, must be known to the decoder
+ * @param  sns        SerialNumbers to encode
+ * @param  count      number of SerialNumbers
+ * @param  out        destination
+ * @param  len        size of destination in bytes
+ * @return Number of bytes written, 0 if destination is too small
+ */
+template <class T>
+size_t serialnumber_encode_group(const SerialNumber<T>& reference, const SerialNumber<T>* sns, size_t count, uint8_t* out, size_t len) {
+    static_assert(sizeof(T) <= 4, "group varints are limited to 32 bits");
+    size_t pos = 0;
+    SerialNumber<T> prev = reference;
+    for (size_t i=0; i<count; i+=4) {
+        if (pos >= len) return 0;
+        const size_t ctrl = pos++;
+        out[ctrl] = 0;
+        for (size_t j=0; (j<4) && (i+j<count); j++) {
+            T zz = serialnumber_zigzag(prev, sns[i+j]);
+            prev = sns[i+j];
+            uint8_t n = 1;
+            while ((n < sizeof(T)) && ((zz >> (8 * n)) != 0)) n++;
+            if (pos + n > len) return 0;
+            out[ctrl] = static_cast<uint8_t>(out[ctrl] | ((n - 1) << (2 * j)));
+            for (uint8_t k=0; k<n; k++) {
+                out[pos + k] = static_cast<uint8_t>(zz >> (8 * k));
+            }
+            pos += n;
+        }
+    }
+    return pos;
+}
+
+/**
+ * @brief  Decode SerialNumbers from zigzag encoded group varints
+ * @param  reference  reference SerialNumber used by the encoder
+ * @param  in         source
+ * @param  len        number of bytes available at in
+ * @param  sns        decoded SerialNumbers
+ * @param  count      number of SerialNumbers to decode
+ * @return Number of bytes read, 0 if the input is invalid, truncated or
+ *         not canonical
+ * @note   Only the encoding written by serialnumber_encode_group() is
+ *         accepted: the most significant byte of a number of more than
+ *         one byte must not be zero, and the unused bits of the last
+ *         control byte must be zero.
+ */
+template <class T>
+size_t serialnumber_decode_group(const SerialNumber<T>& reference, const uint8_t* in, size_t len, SerialNumber<T>* sns, size_t count) {
+    static_assert(sizeof(T) <= 4, "group varints are limited to 32 bits");
+    size_t pos = 0;
+    SerialNumber<T> prev = reference;
+    for (size_t i=0; i<count; i+=4) {
+        if (pos >= len) return 0;
+        const uint8_t ctrl = in[pos++];
+        if ((count - i < 4) && ((ctrl >> (2 * (count - i))) != 0)) return 0;
+        for (size_t j=0; (j<4) && (i+j<count); j++) {
+            const uint8_t n = static_cast<uint8_t>(((ctrl >> (2 * j)) & 0x03) + 1);
+            if ((n > sizeof(T)) || (pos + n > len)) return 0;
+            if ((n > 1) && (in[pos + n - 1] == 0)) return 0;
+            T zz{0};
+            for (uint8_t k=0; k<n; k++) {
+                zz = static_cast<T>(zz | (static_cast<T>(in[pos + k]) << (8 * k)));
+            }
+            pos += n;
+            prev = serialnumber_unzigzag(prev, zz);
+            sns[i+j] = prev;
+        }
+    }
+    return pos;
+}
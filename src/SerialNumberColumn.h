@@ -0,0 +1,154 @@
+/**
+ @file    SerialNumberColumn.h
+ @brief   Header file for SerialNumberColumnWriter and SerialNumberColumnReader classes
+ @author  SerialNumber contributors
+ @version 1.2.0
+ @date    2026-10-16
+ @section license_serialnumber_column_h License
+  
+ The MIT Licence (MIT)
+ 
+ Copyright (c) 2026 SerialNumber contributors
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+*/
+
+/*
+A compact format for long sequences ("columns") of SerialNumbers, e.g. 
+per-packet sequence numbers archived for later analysis.
+
+The column is stored in a caller-provided buffer, which is divided into 
+blocks of fixed size. Each block starts with a header, followed by the 
+encoded SerialNumbers:
+
+    offset                  size       content
+    0                       2          number of SerialNumbers in block
+    2                       sizeof(T)  first SerialNumber in block
+    2 + sizeof(T)           sizeof(T)  lowest SerialNumber in block (RFC1982)
+    2 + 2 * sizeof(T)       sizeof(T)  highest SerialNumber in block (RFC1982)
+    2 + 3 * sizeof(T)       ...        distances to previous SerialNumber
+                                       (zigzag encoded varints)
+
+All numbers in the header are little endian. The distances are computed
+modulo 2^SERIAL_BITS, so wrapping around costs nothing. Monotone 
+sequences take one byte per SerialNumber, as do sequences with small gaps
+or reordering.
+
+Since all blocks have the same size, block k starts at k * block_size.
+Together with lowest and highest SerialNumber in each header, this allows
+random access to blocks without decoding the whole column, e.g. on a 
+memory mapped file. The header is updated with every append(), so the 
+buffer is consistent at any time.
+
+The block size must be at least serialnumber_column_min_block_size<T>(),
+i.e. 2 + 3 * sizeof(T) + varint_max_size<T>() bytes. Otherwise, append() 
+always fails, and the reader reports no blocks (e.g. for a block size of
+0 taken from a corrupt or empty buffer). A few hundred bytes are a good 
+choice.
+
+find() does a binary search over the block headers. This requires the 
+blocks to be in increasing order: the lowest and the highest SerialNumbers
+of the blocks must not decrease, counting from the lowest SerialNumber of
+the first block. This is the case for monotone sequences, even with gaps
+and some reordering, as long as the column spans less than 2^SERIAL_BITS.
+*/
+
+#ifndef SerialNumberColumn_h
+#define SerialNumberColumn_h
+
+#include "SerialNumber.h"
+#include "SerialNumberCodec.h"
+#include "SerialNumberStamp.h"
+
+/* Declaration of helper functions */
+
+// size of block header in bytes
+template <class T>
+constexpr size_t serialnumber_column_header_size(void);
+
+// minimum block size in bytes
+template <class T>
+constexpr size_t serialnumber_column_min_block_size(void);
+
+/* Declaration of the SerialNumberColumnWriter class template */
+
+template <class T>
+class SerialNumberColumnWriter {
+    public:
+        // constructor
+        SerialNumberColumnWriter(uint8_t* buffer, size_t size, size_t block_size); ///< constructor
+
+        // append SerialNumber, return false if buffer is full or block size too small
+        bool append(const SerialNumber<T>& sn);
+
+        // number of blocks in use
+        size_t blocks(void) const;
+
+        // number of bytes in use
+        size_t size(void) const;
+
+    private:
+        bool open_block(const SerialNumber<T>& sn);
+        void write_header(void);
+
+        uint8_t* buf;
+        size_t len;
+        size_t bs;
+        size_t nblk;
+        size_t pos;
+        uint16_t cnt;
+        SerialNumber<T> first;
+        SerialNumber<T> prev;
+        SerialNumber<T> lo;
+        SerialNumber<T> hi;
+};
+
+/* Declaration of the SerialNumberColumnReader class template */
+
+template <class T>
+class SerialNumberColumnReader {
+    public:
+        // constructor
+        SerialNumberColumnReader(const uint8_t* buffer, size_t size, size_t block_size); ///< constructor
+
+        // number of blocks
+        size_t blocks(void) const;
+
+        // header information of a block
+        uint16_t count(size_t block) const;
+        SerialNumber<T> first(size_t block) const;
+        SerialNumber<T> lowest(size_t block) const;
+        SerialNumber<T> highest(size_t block) const;
+
+        // index of first block which might contain sn, blocks() if there is none
+        size_t find(const SerialNumber<T>& sn) const;
+
+        // decode all SerialNumbers of a block, return number of SerialNumbers
+        size_t decode(size_t block, SerialNumber<T>* out) const;
+
+    private:
+        T rel(const SerialNumber<T>& sn) const;
+
+        const uint8_t* buf;
+        size_t len;
+        size_t bs;
+};
+
+#include "SerialNumberColumnClass.hpp"
+
+#endif // SerialNumberColumn_h
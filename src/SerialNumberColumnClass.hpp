@@ -0,0 +1,258 @@
+/**
+ @file    SerialNumberColumnClass.hpp
+ @brief   Implementation file for SerialNumberColumnWriter and SerialNumberColumnReader classes
+ @author  SerialNumber contributors
+ @version 1.2.0
+ @date    2026-10-16
+ @section license_serialnumber_column_class_hpp License
+  
+ The MIT Licence (MIT)
+ 
+ Copyright (c) 2026 SerialNumber contributors
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+*/
+
+/**
+ * @brief  Size of block header in bytes
+ */
+template <class T>
+constexpr size_t serialnumber_column_header_size(void) {
+    return 2 + 3 * sizeof(T);
+}
+
+/**
+ * @brief  Minimum block size in bytes (header and one encoded distance)
+ */
+template <class T>
+constexpr size_t serialnumber_column_min_block_size(void) {
+    return serialnumber_column_header_size<T>() + varint_max_size<T>();
+}
+
+/**
+ * @brief  Constructor
+ * @param  buffer      buffer for the column
+ * @param  size        size of buffer in bytes
+ * @param  block_size  size of a single block in bytes, at least
+ *                     serialnumber_column_min_block_size<T>()
+ */
+template <class T>
+SerialNumberColumnWriter<T>::SerialNumberColumnWriter(uint8_t* buffer, size_t size, size_t block_size) : 
+    buf{buffer}, 
+    len{size}, 
+    bs{block_size}, 
+    nblk{0}, 
+    pos{0}, 
+    cnt{0} {
+    assert(block_size >= serialnumber_column_min_block_size<T>());
+}
+
+/**
+ * @brief  Append a SerialNumber to the column
+ * @param  sn  SerialNumber to append
+ * @return true on success, false if the buffer is full or the block 
+ *         size is too small
+ */
+template <class T>
+bool SerialNumberColumnWriter<T>::append(const SerialNumber<T>& sn) {
+    if (bs < serialnumber_column_min_block_size<T>()) return false;
+    if (cnt == 0) return open_block(sn);
+    uint8_t tmp[varint_max_size<T>()];
+    const size_t n = varint_encode(serialnumber_zigzag(prev, sn), tmp);
+    if ((pos + n > bs) || (cnt == 0xFFFF)) return open_block(sn);
+    for (size_t i=0; i<n; i++) {
+        buf[(nblk - 1) * bs + pos + i] = tmp[i];
+    }
+    pos += n;
+    cnt++;
+    prev = sn;
+    if (sn < lo) lo = sn;
+    if (sn > hi) hi = sn;
+    write_header();
+    return true;
+}
+
+/**
+ * @brief  Number of blocks in use
+ */
+template <class T>
+size_t SerialNumberColumnWriter<T>::blocks(void) const {
+    return nblk;
+}
+
+/**
+ * @brief  Number of bytes in use
+ * @note   Only these bytes have to be stored to persist the column.
+ */
+template <class T>
+size_t SerialNumberColumnWriter<T>::size(void) const {
+    return nblk * bs;
+}
+
+/**
+ * @brief  Start a new block with sn as first SerialNumber
+ */
+template <class T>
+bool SerialNumberColumnWriter<T>::open_block(const SerialNumber<T>& sn) {
+    if ((nblk + 1) * bs > len) {
+        cnt = 0;
+        return false;
+    }
+    nblk++;
+    pos = serialnumber_column_header_size<T>();
+    cnt = 1;
+    first = sn;
+    prev = sn;
+    lo = sn;
+    hi = sn;
+    write_header();
+    return true;
+}
+
+/**
+ * @brief  Write header of current block
+ */
+template <class T>
+void SerialNumberColumnWriter<T>::write_header(void) {
+    uint8_t* p = buf + (nblk - 1) * bs;
+    stamp_value(p, cnt, SerialNumberEndianness::little);
+    stamp_value(p + 2, first.value(), SerialNumberEndianness::little);
+    stamp_value(p + 2 + sizeof(T), lo.value(), SerialNumberEndianness::little);
+    stamp_value(p + 2 + 2 * sizeof(T), hi.value(), SerialNumberEndianness::little);
+}
+
+/**
+ * @brief  Constructor
+ * @param  buffer      buffer holding the column
+ * @param  size        number of bytes in use (see SerialNumberColumnWriter::size())
+ * @param  block_size  size of a single block in bytes, at least
+ *                     serialnumber_column_min_block_size<T>()
+ */
+template <class T>
+SerialNumberColumnReader<T>::SerialNumberColumnReader(const uint8_t* buffer, size_t size, size_t block_size) : 
+    buf{buffer}, 
+    len{size}, 
+    bs{block_size} {
+    assert(block_size >= serialnumber_column_min_block_size<T>());
+}
+
+/**
+ * @brief  Number of blocks
+ * @return Number of blocks, 0 if the block size is too small (e.g. 0, 
+ *         read from a corrupt or empty buffer)
+ */
+template <class T>
+size_t SerialNumberColumnReader<T>::blocks(void) const {
+    if (bs < serialnumber_column_min_block_size<T>()) return 0;
+    return len / bs;
+}
+
+/**
+ * @brief  Number of SerialNumbers in a block
+ */
+template <class T>
+uint16_t SerialNumberColumnReader<T>::count(size_t block) const {
+    return read_value<uint16_t>(buf + block * bs, SerialNumberEndianness::little);
+}
+
+/**
+ * @brief  First SerialNumber in a block
+ */
+template <class T>
+SerialNumber<T> SerialNumberColumnReader<T>::first(size_t block) const {
+    return SerialNumber<T>{read_value<T>(buf + block * bs + 2, SerialNumberEndianness::little)};
+}
+
+/**
+ * @brief  Lowest SerialNumber (according to RFC1982) in a block
+ */
+template <class T>
+SerialNumber<T> SerialNumberColumnReader<T>::lowest(size_t block) const {
+    return SerialNumber<T>{read_value<T>(buf + block * bs + 2 + sizeof(T), SerialNumberEndianness::little)};
+}
+
+/**
+ * @brief  Highest SerialNumber (according to RFC1982) in a block
+ */
+template <class T>
+SerialNumber<T> SerialNumberColumnReader<T>::highest(size_t block) const {
+    return SerialNumber<T>{read_value<T>(buf + block * bs + 2 + 2 * sizeof(T), SerialNumberEndianness::little)};
+}
+
+/**
+ * @brief  Find first block which might contain a SerialNumber
+ * @param  sn  SerialNumber to look for
+ * @return Index of the first block with lowest <= sn <= highest, 
+ *         blocks() if there is no such block
+ * @note   Only the headers are read, no block is decoded. The blocks 
+ *         must be in increasing order (see above).
+ */
+template <class T>
+size_t SerialNumberColumnReader<T>::find(const SerialNumber<T>& sn) const {
+    const size_t nb = blocks();
+    if (nb == 0) return nb;
+    const T key = rel(sn);
+
+    // binary search for first block with highest >= sn
+    size_t lo = 0;
+    size_t hi = nb;
+    while (lo < hi) {
+        const size_t mid = lo + (hi - lo) / 2;
+        if (rel(highest(mid)) < key) lo = mid + 1;
+        else hi = mid;
+    }
+
+    // blocks may overlap due to reordering, check following blocks as well
+    for (size_t k=lo; (k < nb) && (rel(lowest(k)) <= key); k++) {
+        if (key <= rel(highest(k))) return k;
+    }
+    return nb;
+}
+
+/**
+ * @brief  SerialNumber relative to the lowest SerialNumber of the first block
+ */
+template <class T>
+T SerialNumberColumnReader<T>::rel(const SerialNumber<T>& sn) const {
+    return static_cast<T>(sn.value() - lowest(0).value());
+}
+
+/**
+ * @brief  Decode all SerialNumbers of a block
+ * @param  block  index of block
+ * @param  out    destination, must have room for count(block) SerialNumbers
+ * @return Number of SerialNumbers decoded
+ */
+template <class T>
+size_t SerialNumberColumnReader<T>::decode(size_t block, SerialNumber<T>* out) const {
+    const uint8_t* p = buf + block * bs;
+    const uint16_t n = count(block);
+    if (n == 0) return 0;
+    SerialNumber<T> sn = first(block);
+    out[0] = sn;
+    size_t pos = serialnumber_column_header_size<T>();
+    for (uint16_t i=1; i<n; i++) {
+        T zz{0};
+        const size_t used = varint_decode(p + pos, bs - pos, zz);
+        if (used == 0) return i;
+        pos += used;
+        sn = serialnumber_unzigzag(sn, zz);
+        out[i] = sn;
+    }
+    return n;
+}
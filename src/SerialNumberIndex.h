@@ -0,0 +1,136 @@
+/**
+ @file    SerialNumberIndex.h
+ @brief   Header file for SerialNumberIndex class
+ @author  SerialNumber contributors
+ @version 1.2.0
+ @date    2026-10-16
+ @section license_serialnumberindex_h License
+  
+ The MIT Licence (MIT)
+ 
+ Copyright (c) 2026 SerialNumber contributors
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+*/
+
+/*
+A SerialNumberIndex maps SerialNumbers to values, e.g. the entries of a 
+replicated log to their positions in a file. Its scope is restricted to 
+append-mostly use: keys arrive in increasing order, apart from a bounded
+amount of reordering, and are removed from the oldest end. It is not a
+general ordered map; workloads with inserts at arbitrary positions need
+a node-based tree (e.g. std::map with a comparator relative to a base 
+as described below).
+
+RFC1982 comparison is not a strict weak ordering over the full range of
+SerialNumbers, so it can not be used for sorted containers directly. 
+Instead, all keys are compared relative to a base: key k is ordered by 
+(k - base) mod 2^SERIAL_BITS. This is a strict weak ordering, and it 
+agrees with RFC1982 as long as all keys are within 
+[base, base + 2^(SERIAL_BITS - 1)). Keys outside of this range are 
+rejected. The base is moved forward by truncate_before(), so the index can
+follow a log whose SerialNumbers wrap around any number of times.
+
+This is not a tree: entries are kept sorted in a single contiguous ring 
+of N slots (N must be a power of two). Inserting a key moves all entries
+with greater keys by one slot. For append-mostly use, this is cheaper 
+than maintaining tree nodes. With n entries, of which m have keys 
+greater than the inserted key:
+
+ - find(), lower_bound(): binary search, O(log n)
+ - insert() of a key greater than all others (m = 0): O(1), compared to 
+   the newest key first, no search
+ - insert() of another key: O(log n + m). If keys arrive at most m 
+   positions out of order, this is bounded by the reordering; a key 
+   older than all others moves all n entries.
+ - truncate_before(): O(log n), no entries are moved
+ - assign(): bulk load from sorted arrays, O(n)
+ - scan(): O(log n) plus the number of entries visited
+
+The index does not allocate memory. All N slots are part of the object,
+which takes N * (sizeof(T) + sizeof(V)) bytes plus a few words, e.g. 
+256 MiB for N = 2^24 (room for 10M entries) with uint64_t keys and 
+values. Such instances must not live on the stack; create them as static
+objects or with new. V must be default constructible and copy 
+assignable.
+*/
+
+#ifndef SerialNumberIndex_h
+#define SerialNumberIndex_h
+
+#include "SerialNumber.h"
+
+/* Declaration of the SerialNumberIndex class template */
+
+template <class T, class V, size_t N>
+class SerialNumberIndex {
+    public:
+        // constructor
+        SerialNumberIndex(const SerialNumber<T>& base=SerialNumber<T>{0}); ///< constructor
+
+        // number of entries and maximum number of entries
+        size_t size(void) const;
+        bool empty(void) const;
+        static constexpr size_t capacity(void) { return N; }
+
+        // lowest key which can be inserted
+        SerialNumber<T> base(void) const;
+
+        // insert or overwrite entry, return false if full or key out of range
+        bool insert(const SerialNumber<T>& key, const V& value);
+
+        // replace all entries by n entries with sorted keys, return false if not possible
+        bool assign(const T* keys, const V* values, size_t n);
+
+        // value for key, nullptr if not found
+        V* find(const SerialNumber<T>& key);
+        const V* find(const SerialNumber<T>& key) const;
+
+        // position of the first entry with a key not lower than key
+        size_t lower_bound(const SerialNumber<T>& key) const;
+
+        // entry at position pos (0 ... size()-1)
+        SerialNumber<T> key_at(size_t pos) const;
+        V& value_at(size_t pos);
+        const V& value_at(size_t pos) const;
+
+        // call f(key, value) for all entries with keys in [first, last], return number of calls
+        template <class F>
+        size_t scan(const SerialNumber<T>& first, const SerialNumber<T>& last, F f) const;
+
+        // remove all entries with keys lower than key, move base to key, return number of removed entries
+        size_t truncate_before(const SerialNumber<T>& key);
+
+        // remove all entries, keep base
+        void clear(void);
+
+    private:
+        T rel(T key) const;
+        bool in_range(T key) const;
+        size_t slot(size_t pos) const;
+
+        T keys[N];
+        V vals[N];
+        T b;
+        size_t head;
+        size_t count;
+};
+
+#include "SerialNumberIndexClass.hpp"
+
+#endif // SerialNumberIndex_h
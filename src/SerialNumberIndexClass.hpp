@@ -0,0 +1,263 @@
+/**
+ @file    SerialNumberIndexClass.hpp
+ @brief   Implementation file for SerialNumberIndex class
+ @author  SerialNumber contributors
+ @version 1.2.0
+ @date    2026-10-16
+ @section license_serialnumberindex_class_hpp License
+  
+ The MIT Licence (MIT)
+ 
+ Copyright (c) 2026 SerialNumber contributors
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+*/
+
+/**
+ * @brief  Constructor
+ * @param  base  lowest key which can be inserted
+ */
+template <class T, class V, size_t N>
+SerialNumberIndex<T, V, N>::SerialNumberIndex(const SerialNumber<T>& base) : 
+    b{base.value()}, head{0}, count{0} {
+    static_assert((N >= 1) && ((N & (N - 1)) == 0), "N must be a power of two");
+}
+
+/**
+ * @brief  Number of entries
+ */
+template <class T, class V, size_t N>
+size_t SerialNumberIndex<T, V, N>::size(void) const {
+    return count;
+}
+
+/**
+ * @brief  True if there are no entries
+ */
+template <class T, class V, size_t N>
+bool SerialNumberIndex<T, V, N>::empty(void) const {
+    return count == 0;
+}
+
+/**
+ * @brief  Lowest key which can be inserted
+ */
+template <class T, class V, size_t N>
+SerialNumber<T> SerialNumberIndex<T, V, N>::base(void) const {
+    return SerialNumber<T>{b};
+}
+
+/**
+ * @brief  Insert an entry, or overwrite the value of an existing entry
+ * @return false if the index is full or key is not within 
+ *         [base, base + 2^(SERIAL_BITS - 1))
+ */
+template <class T, class V, size_t N>
+bool SerialNumberIndex<T, V, N>::insert(const SerialNumber<T>& key, const V& value) {
+    const T k = key.value();
+    if (!in_range(k)) return false;
+    if ((count == 0) || (rel(keys[slot(count - 1)]) < rel(k))) {
+        // append after the newest key
+        if (count == N) return false;
+        keys[slot(count)] = k;
+        vals[slot(count)] = value;
+        count++;
+        return true;
+    }
+    const size_t pos = lower_bound(key);
+    if ((pos < count) && (keys[slot(pos)] == k)) {
+        vals[slot(pos)] = value;
+        return true;
+    }
+    if (count == N) return false;
+    for (size_t i=count; i>pos; i--) {
+        keys[slot(i)] = keys[slot(i-1)];
+        vals[slot(i)] = vals[slot(i-1)];
+    }
+    keys[slot(pos)] = k;
+    vals[slot(pos)] = value;
+    count++;
+    return true;
+}
+
+/**
+ * @brief  Replace all entries (bulk load)
+ * @param  keys    n keys, strictly increasing relative to base
+ * @param  values  n values
+ * @param  n       number of entries
+ * @return false if n is greater than N, or keys are not strictly 
+ *         increasing or not in range. In this case, the index is left 
+ *         unchanged.
+ */
+template <class T, class V, size_t N>
+bool SerialNumberIndex<T, V, N>::assign(const T* keys_in, const V* values, size_t n) {
+    if (n > N) return false;
+    for (size_t i=0; i<n; i++) {
+        if (!in_range(keys_in[i])) return false;
+        if ((i > 0) && (rel(keys_in[i]) <= rel(keys_in[i-1]))) return false;
+    }
+    for (size_t i=0; i<n; i++) {
+        keys[i] = keys_in[i];
+        vals[i] = values[i];
+    }
+    head = 0;
+    count = n;
+    return true;
+}
+
+/**
+ * @brief  Value for a key
+ * @return Pointer to the value, nullptr if there is no entry for key
+ */
+template <class T, class V, size_t N>
+V* SerialNumberIndex<T, V, N>::find(const SerialNumber<T>& key) {
+    const size_t pos = lower_bound(key);
+    if ((pos < count) && (keys[slot(pos)] == key.value())) return &vals[slot(pos)];
+    return nullptr;
+}
+
+/**
+ * @brief  Value for a key
+ * @return Pointer to the value, nullptr if there is no entry for key
+ */
+template <class T, class V, size_t N>
+const V* SerialNumberIndex<T, V, N>::find(const SerialNumber<T>& key) const {
+    const size_t pos = lower_bound(key);
+    if ((pos < count) && (keys[slot(pos)] == key.value())) return &vals[slot(pos)];
+    return nullptr;
+}
+
+/**
+ * @brief  Position of the first entry with a key not lower than key
+ * @return Position (0 ... size()), size() if there is no such entry
+ * @note   A key out of range is treated as lower than all entries if it
+ *         is lower than base according to RFC1982, and as greater than 
+ *         all entries otherwise.
+ */
+template <class T, class V, size_t N>
+size_t SerialNumberIndex<T, V, N>::lower_bound(const SerialNumber<T>& key) const {
+    if (!in_range(key.value())) {
+        return serialnumber_less(key.value(), b) ? 0 : count;
+    }
+    const T k = rel(key.value());
+    size_t lo = 0;
+    size_t hi = count;
+    while (lo < hi) {
+        const size_t mid = lo + (hi - lo) / 2;
+        if (rel(keys[slot(mid)]) < k) lo = mid + 1;
+        else hi = mid;
+    }
+    return lo;
+}
+
+/**
+ * @brief  Key of the entry at a position
+ * @param  pos  position (0 ... size()-1)
+ */
+template <class T, class V, size_t N>
+SerialNumber<T> SerialNumberIndex<T, V, N>::key_at(size_t pos) const {
+    return SerialNumber<T>{keys[slot(pos)]};
+}
+
+/**
+ * @brief  Value of the entry at a position
+ * @param  pos  position (0 ... size()-1)
+ */
+template <class T, class V, size_t N>
+V& SerialNumberIndex<T, V, N>::value_at(size_t pos) {
+    return vals[slot(pos)];
+}
+
+/**
+ * @brief  Value of the entry at a position
+ * @param  pos  position (0 ... size()-1)
+ */
+template <class T, class V, size_t N>
+const V& SerialNumberIndex<T, V, N>::value_at(size_t pos) const {
+    return vals[slot(pos)];
+}
+
+/**
+ * @brief  Visit all entries with keys in [first, last], in order
+ * @param  f  functor, called as f(SerialNumber<T> key, const V& value)
+ * @return Number of entries visited
+ */
+template <class T, class V, size_t N>
+template <class F>
+size_t SerialNumberIndex<T, V, N>::scan(const SerialNumber<T>& first, const SerialNumber<T>& last, F f) const {
+    size_t visited = 0;
+    T end = static_cast<T>(~static_cast<T>(0));
+    if (in_range(last.value())) end = rel(last.value());
+    else if (serialnumber_less(last.value(), b)) return 0;
+    for (size_t pos = lower_bound(first); pos < count; pos++) {
+        const T k = keys[slot(pos)];
+        if (rel(k) > end) break;
+        f(SerialNumber<T>{k}, vals[slot(pos)]);
+        visited++;
+    }
+    return visited;
+}
+
+/**
+ * @brief  Remove all entries with keys lower than key
+ * @param  key  new base, must not be lower than the current base
+ * @return Number of removed entries
+ */
+template <class T, class V, size_t N>
+size_t SerialNumberIndex<T, V, N>::truncate_before(const SerialNumber<T>& key) {
+    if (!serialnumber_greater(key.value(), b)) return 0;
+    const size_t pos = lower_bound(key);
+    head = (head + pos) & (N - 1);
+    count -= pos;
+    b = key.value();
+    return pos;
+}
+
+/**
+ * @brief  Remove all entries, keep base
+ */
+template <class T, class V, size_t N>
+void SerialNumberIndex<T, V, N>::clear(void) {
+    head = 0;
+    count = 0;
+}
+
+/**
+ * @brief  Key relative to base
+ */
+template <class T, class V, size_t N>
+T SerialNumberIndex<T, V, N>::rel(T key) const {
+    return static_cast<T>(key - b);
+}
+
+/**
+ * @brief  True if key is within [base, base + 2^(SERIAL_BITS - 1))
+ */
+template <class T, class V, size_t N>
+bool SerialNumberIndex<T, V, N>::in_range(T key) const {
+    constexpr T maxdiff = static_cast<T>(1) << ((sizeof(T) * 8) - 1);
+    return rel(key) < maxdiff;
+}
+
+/**
+ * @brief  Index into the ring of the entry at position pos
+ */
+template <class T, class V, size_t N>
+size_t SerialNumberIndex<T, V, N>::slot(size_t pos) const {
+    return (head + pos) & (N - 1);
+}
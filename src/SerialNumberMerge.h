@@ -0,0 +1,103 @@
+/**
+ @file    SerialNumberMerge.h
+ @brief   Header file for SerialNumberMerge class (k-way merge)
+ @author  SerialNumber contributors
+ @version 1.2.0
+ @date    2026-10-16
+ @section license_serialnumber_merge_h License
+  
+ The MIT Licence (MIT)
+ 
+ Copyright (c) 2026 SerialNumber contributors
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+*/
+
+/*
+A SerialNumberMerge merges K streams of records, each sorted by a 
+SerialNumber key, into a single stream sorted by that key, e.g. packets
+received via several links.
+
+The merge uses a "loser tree": After the initial setup, each record 
+taken from the merge costs about log2(K) comparisons, and only the path
+from the stream the record was taken from to the root is updated.
+
+Comparing SerialNumbers according to RFC1982 is not a strict weak order
+over the full range of values. Instead, all keys are "rebased" relative 
+to a base SerialNumber (key - base, modulo 2^SERIAL_BITS), and the rebased
+keys are compared as plain unsigned integers. This yields the RFC1982 
+order as long as all keys are in [base, base + 2^(SERIAL_BITS - 1)). 
+If the streams run longer than that, move the base forward with rebase().
+
+Each stream is a range [begin, end) of records in memory. KeyOf is a 
+functor which returns the SerialNumber key of a record. For records 
+which are SerialNumbers themselves, use SerialNumberKey<T> (the default).
+Records with equal keys are taken from the stream with the lower index
+first. No memory is allocated.
+*/
+
+#ifndef SerialNumberMerge_h
+#define SerialNumberMerge_h
+
+#include "SerialNumber.h"
+
+/* Declaration of default key functor */
+
+template <class T>
+struct SerialNumberKey {
+    const SerialNumber<T>& operator() (const SerialNumber<T>& sn) const { return sn; } ///< identity
+};
+
+/* Declaration of the SerialNumberMerge class template */
+
+template <class T, class Record, size_t K, class KeyOf=SerialNumberKey<T> >
+class SerialNumberMerge {
+    public:
+        // constructor
+        SerialNumberMerge(const Record* const* begins, const Record* const* ends, const SerialNumber<T>& base, KeyOf key=KeyOf()); ///< constructor
+
+        // true if all streams are exhausted
+        bool empty(void) const;
+
+        // next record without removing it, nullptr if empty
+        const Record* peek(void) const;
+
+        // remove and return next record, nullptr if empty
+        const Record* next(void);
+
+        // remove up to n records and store pointers to them in out, return number of records
+        size_t next(const Record** out, size_t n);
+
+        // move base for rebasing keys forward
+        void rebase(const SerialNumber<T>& base);
+
+    private:
+        bool beats(size_t a, size_t c) const;
+        void setup(void);
+
+        const Record* cur[K];
+        const Record* last[K];
+        T keys[K];
+        size_t tree[K];
+        T b;
+        KeyOf kf;
+};
+
+#include "SerialNumberMergeClass.hpp"
+
+#endif // SerialNumberMerge_h
@@ -0,0 +1,152 @@
+/**
+ @file    SerialNumberMergeClass.hpp
+ @brief   Implementation file for SerialNumberMerge class (k-way merge)
+ @author  SerialNumber contributors
+ @version 1.2.0
+ @date    2026-10-16
+ @section license_serialnumber_merge_class_hpp License
+  
+ The MIT Licence (MIT)
+ 
+ Copyright (c) 2026 SerialNumber contributors
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+*/
+
+/**
+ * @brief  Constructor
+ * @param  begins  first record of each of the K streams
+ * @param  ends    end (one past the last record) of each of the K streams
+ * @param  base    base for rebasing, must not be greater than any key
+ * @param  key     functor returning the SerialNumber key of a record
+ */
+template <class T, class Record, size_t K, class KeyOf>
+SerialNumberMerge<T, Record, K, KeyOf>::SerialNumberMerge(const Record* const* begins, const Record* const* ends, const SerialNumber<T>& base, KeyOf key) : 
+    b{base.value()}, 
+    kf{key} {
+    static_assert(K > 0, "at least one stream is needed");
+    for (size_t s=0; s<K; s++) {
+        cur[s] = begins[s];
+        last[s] = ends[s];
+    }
+    setup();
+}
+
+/**
+ * @brief  Check if all streams are exhausted
+ */
+template <class T, class Record, size_t K, class KeyOf>
+bool SerialNumberMerge<T, Record, K, KeyOf>::empty(void) const {
+    return cur[tree[0]] == last[tree[0]];
+}
+
+/**
+ * @brief  Next record without removing it
+ * @return Pointer to the record with the lowest key, nullptr if empty
+ */
+template <class T, class Record, size_t K, class KeyOf>
+const Record* SerialNumberMerge<T, Record, K, KeyOf>::peek(void) const {
+    return empty() ? nullptr : cur[tree[0]];
+}
+
+/**
+ * @brief  Remove and return next record
+ * @return Pointer to the record with the lowest key, nullptr if empty
+ */
+template <class T, class Record, size_t K, class KeyOf>
+const Record* SerialNumberMerge<T, Record, K, KeyOf>::next(void) {
+    size_t s = tree[0];
+    if (cur[s] == last[s]) return nullptr;
+    const Record* rec = cur[s]++;
+    if (cur[s] != last[s]) keys[s] = static_cast<T>(kf(*cur[s]).value() - b);
+    // replay the matches on the path from leaf s to the root
+    for (size_t node = (s + K) / 2; node > 0; node /= 2) {
+        if (beats(tree[node], s)) {
+            const size_t tmp = tree[node];
+            tree[node] = s;
+            s = tmp;
+        }
+    }
+    tree[0] = s;
+    return rec;
+}
+
+/**
+ * @brief  Remove multiple records
+ * @param  out  destination for pointers to the records
+ * @param  n    maximum number of records
+ * @return Number of records stored in out
+ */
+template <class T, class Record, size_t K, class KeyOf>
+size_t SerialNumberMerge<T, Record, K, KeyOf>::next(const Record** out, size_t n) {
+    size_t i = 0;
+    while ((i < n) && !empty()) {
+        out[i++] = next();
+    }
+    return i;
+}
+
+/**
+ * @brief  Move base for rebasing keys forward
+ * @param  base  new base, must not be greater than any remaining key
+ * @note   Rebuilds the tree, i.e. costs about K comparisons.
+ */
+template <class T, class Record, size_t K, class KeyOf>
+void SerialNumberMerge<T, Record, K, KeyOf>::rebase(const SerialNumber<T>& base) {
+    b = base.value();
+    setup();
+}
+
+/**
+ * @brief  Check if stream a wins over stream c
+ * @note   Exhausted streams always lose, ties go to the lower index.
+ */
+template <class T, class Record, size_t K, class KeyOf>
+bool SerialNumberMerge<T, Record, K, KeyOf>::beats(size_t a, size_t c) const {
+    if (cur[a] == last[a]) return false;
+    if (cur[c] == last[c]) return true;
+    return (keys[a] < keys[c]) || ((keys[a] == keys[c]) && (a < c));
+}
+
+/**
+ * @brief  Compute rebased keys and build the tree
+ */
+template <class T, class Record, size_t K, class KeyOf>
+void SerialNumberMerge<T, Record, K, KeyOf>::setup(void) {
+    for (size_t s=0; s<K; s++) {
+        keys[s] = (cur[s] != last[s]) ? static_cast<T>(kf(*cur[s]).value() - b) : T(0);
+    }
+    // winners of all inner nodes, leaf of stream s is node K + s
+    size_t winner[2 * K];
+    for (size_t s=0; s<K; s++) {
+        winner[K + s] = s;
+    }
+    for (size_t node = K - 1; node > 0; node--) {
+        const size_t l = winner[2 * node];
+        const size_t r = winner[2 * node + 1];
+        if (beats(l, r)) {
+            winner[node] = l;
+            tree[node] = r;
+        }
+        else {
+            winner[node] = r;
+            tree[node] = l;
+        }
+    }
+    tree[0] = (K > 1) ? winner[1] : 0;
+}
@@ -2,8 +2,8 @@
  @file    SerialNumberOperators.hpp
  @brief   Implementation file for SerialNumber class (RFC1982)
  @author  Andreas Grommek
- @version 1.1.0
- @date    2021-10-10
+ @version 1.2.0
+ @date    2026-10-16
  @section license_serialnumber_operators_hpp License
   
  The MIT Licence (MIT)
@@ -28,122 +28,177 @@
  SOFTWARE.
 */
 
-/* Definition of comparison operators for SerialNumber objects */
-
-// equality operator
-template <class T, class U>
-bool operator== (const SerialNumber<T>& sn1, const SerialNumber<T>& sn2) {
-    return sn1.value() == sn2.value();
+#if defined(UINT8_MAX) && defined(__AVR__)
+#include <avr/pgmspace.h>
+#define SERIALNUMBER_PROGMEM PROGMEM
+#define SERIALNUMBER_READ_TABLE(addr) pgm_read_byte(addr)
+#else
+#define SERIALNUMBER_PROGMEM
+#define SERIALNUMBER_READ_TABLE(addr) (*(addr))
+#endif
+
+/* Definition of comparison kernels */
+
+// "lower than" kernel
+template <class T>
+bool serialnumber_less(T i1, T i2) {
+    SERIALNUMBER_COUNT_COMPARISON(T, i1, i2);
+    constexpr T maxdiff = static_cast<T>(1) << ((sizeof(T) * 8) - 1);
+    const T d = static_cast<T>(i2 - i1);
+    return (d != 0) && (d < maxdiff);
 }
 
-template <class T, class U>
-bool operator== (const SerialNumber<T>& sn1, U sn2) {
-    return sn1.value() == static_cast<T>(sn2);
+// "greater than" kernel
+template <class T>
+bool serialnumber_greater(T i1, T i2) {
+    SERIALNUMBER_COUNT_COMPARISON(T, i1, i2);
+    constexpr T maxdiff = static_cast<T>(1) << ((sizeof(T) * 8) - 1);
+    const T d = static_cast<T>(i2 - i1);
+    return d > maxdiff;
 }
 
-template <class T, class U>
-bool operator== (T sn1, const SerialNumber<U>& sn2) {
-    return static_cast<U>(sn1) == sn2.value();
-}
+#ifdef UINT8_MAX
+/*
+Lookup tables for uint8_t, indexed by the distance d = i2 - i1. Bit (d % 8) 
+of byte (d / 8) is set if the respective relation holds for distance d.
+Both tables are generated at compile time.
+*/
 
-// inequality operator
-template <class T, class U>
-bool operator!= (const SerialNumber<T>& sn1, const SerialNumber<T>& sn2) {
-    return sn1.value() != sn2.value();
-}
+// value of a single bit in the lookup tables
+constexpr uint8_t serialnumber_table_bit(unsigned int d, bool greater) {
+    return greater ? (d > 128u) : ((d != 0u) && (d < 128u));
+}
+
+// value of byte k (i.e. distances 8*k ... 8*k+7) in the lookup tables
+constexpr uint8_t serialnumber_table_byte(unsigned int k, bool greater) {
+    return static_cast<uint8_t>(
+        (serialnumber_table_bit(8u * k + 0u, greater) << 0) |
+        (serialnumber_table_bit(8u * k + 1u, greater) << 1) |
+        (serialnumber_table_bit(8u * k + 2u, greater) << 2) |
+        (serialnumber_table_bit(8u * k + 3u, greater) << 3) |
+        (serialnumber_table_bit(8u * k + 4u, greater) << 4) |
+        (serialnumber_table_bit(8u * k + 5u, greater) << 5) |
+        (serialnumber_table_bit(8u * k + 6u, greater) << 6) |
+        (serialnumber_table_bit(8u * k + 7u, greater) << 7));
+}
+
+#define SERIALNUMBER_TABLE_ROW(k, g) \
+    serialnumber_table_byte((k) + 0u, g), serialnumber_table_byte((k) + 1u, g), \
+    serialnumber_table_byte((k) + 2u, g), serialnumber_table_byte((k) + 3u, g), \
+    serialnumber_table_byte((k) + 4u, g), serialnumber_table_byte((k) + 5u, g), \
+    serialnumber_table_byte((k) + 6u, g), serialnumber_table_byte((k) + 7u, g)
+
+/*
+The tables are static data members of a class template. Thus, there is a 
+single definition shared by all translation units (like for an inline 
+variable in C++17), which the inline kernels below may refer to.
+*/
+template <class Dummy=void>
+struct SerialNumberTables {
+    static const uint8_t less[32];    ///< lookup table for "lower than"
+    static const uint8_t greater[32]; ///< lookup table for "greater than"
+};
 
-template <class T, class U>
-bool operator!= (const SerialNumber<T>& sn1, U sn2) {
-    return sn1.value() != static_cast<T>(sn2);
-}
+template <class Dummy>
+const uint8_t SerialNumberTables<Dummy>::less[32] SERIALNUMBER_PROGMEM = {
+    SERIALNUMBER_TABLE_ROW( 0u, false), SERIALNUMBER_TABLE_ROW( 8u, false),
+    SERIALNUMBER_TABLE_ROW(16u, false), SERIALNUMBER_TABLE_ROW(24u, false)
+};
 
-template <class T, class U>
-bool operator!= (T sn1, const SerialNumber<U>& sn2) {
-    return static_cast<U>(sn1) != sn2.value();
-}
+template <class Dummy>
+const uint8_t SerialNumberTables<Dummy>::greater[32] SERIALNUMBER_PROGMEM = {
+    SERIALNUMBER_TABLE_ROW( 0u, true), SERIALNUMBER_TABLE_ROW( 8u, true),
+    SERIALNUMBER_TABLE_ROW(16u, true), SERIALNUMBER_TABLE_ROW(24u, true)
+};
 
-// lower-than operator
-template <class T, class U>
-bool operator< (const SerialNumber<T>& sn1, const SerialNumber<T>& sn2) {
-    constexpr T maxdiff = static_cast<T>(1) << ((sizeof(T) * 8) - 1);
-    if      ((sn1.value() < sn2.value()) && (sn2.value() - sn1.value()) < maxdiff) return true;
-    else if ((sn1.value() > sn2.value()) && (sn1.value() - sn2.value()) > maxdiff) return true;
-    return false;    
-}
+#undef SERIALNUMBER_TABLE_ROW
 
-template <class T, class U>
-bool operator< (const SerialNumber<T>& sn1, U sn2) {
-    constexpr T maxdiff = static_cast<T>(1) << ((sizeof(T) * 8) - 1);
-    const T sn2c = static_cast<T>(sn2);
-    if      ((sn1.value() < sn2c) && (sn2c - sn1.value()) < maxdiff) return true;
-    else if ((sn1.value() > sn2c) && (sn1.value() - sn2c) > maxdiff) return true;
-    return false;   
+// "lower than" kernel for uint8_t, using a lookup table
+inline bool serialnumber_less_table(uint8_t i1, uint8_t i2) {
+    SERIALNUMBER_COUNT_COMPARISON(uint8_t, i1, i2);
+    const uint8_t d = static_cast<uint8_t>(i2 - i1);
+    return (SERIALNUMBER_READ_TABLE(&SerialNumberTables<>::less[d >> 3]) >> (d & 7)) & 1;
 }
 
-template <class T, class U>
-bool operator< (T sn1, const SerialNumber<U>& sn2) {
-    constexpr T maxdiff = static_cast<T>(1) << ((sizeof(T) * 8) - 1);
-    const U sn1c = static_cast<U>(sn1);
-    if      ((sn1c < sn2.value()) && (sn2.value() - sn1c) < maxdiff) return true;
-    else if ((sn1c > sn2.value()) && (sn1c - sn2.value()) > maxdiff) return true;
-    return false;   
+// "greater than" kernel for uint8_t, using a lookup table
+inline bool serialnumber_greater_table(uint8_t i1, uint8_t i2) {
+    SERIALNUMBER_COUNT_COMPARISON(uint8_t, i1, i2);
+    const uint8_t d = static_cast<uint8_t>(i2 - i1);
+    return (SERIALNUMBER_READ_TABLE(&SerialNumberTables<>::greater[d >> 3]) >> (d & 7)) & 1;
 }
 
-// greater-than operator
-template <class T, class U>
-bool operator> (const SerialNumber<T>& sn1, const SerialNumber<T>& sn2) {
-    constexpr T maxdiff = static_cast<T>(1) << ((sizeof(T) * 8) - 1);
-    if      ((sn1.value() < sn2.value()) && (sn2.value() - sn1.value()) > maxdiff) return true;
-    else if ((sn1.value() > sn2.value()) && (sn1.value() - sn2.value()) < maxdiff) return true;
-    return false;
+#ifdef SERIALNUMBER_UINT8_TABLE
+// use lookup tables in comparison operators for uint8_t
+template <>
+inline bool serialnumber_less<uint8_t>(uint8_t i1, uint8_t i2) {
+    return serialnumber_less_table(i1, i2);
 }
 
-template <class T, class U>
-bool operator> (const SerialNumber<T>& sn1, U sn2) {
-    constexpr T maxdiff = static_cast<T>(1) << ((sizeof(T) * 8) - 1);
-    const T sn2c = static_cast<T>(sn2);
-    if      ((sn1.value() < sn2c) && (sn2c - sn1.value()) > maxdiff) return true;
-    else if ((sn1.value() > sn2c) && (sn1.value() - sn2c) < maxdiff) return true;
-    return false;
+template <>
+inline bool serialnumber_greater<uint8_t>(uint8_t i1, uint8_t i2) {
+    return serialnumber_greater_table(i1, i2);
 }
+#endif // SERIALNUMBER_UINT8_TABLE
+#endif // UINT8_MAX
 
-template <class T, class U>
-bool operator> (T sn1, const SerialNumber<U>& sn2) {
+/* Definition of comparison functions with policy for the critical distance */
+
+// "lower than" with policy
+template <class P, class T>
+bool serialnumber_less(const SerialNumber<T>& sn1, const SerialNumber<T>& sn2) {
+    SERIALNUMBER_COUNT_COMPARISON(T, sn1.value(), sn2.value());
     constexpr T maxdiff = static_cast<T>(1) << ((sizeof(T) * 8) - 1);
-    const U sn1c = static_cast<U>(sn1);
-    if      ((sn1c < sn2.value()) && (sn2.value() - sn1c) > maxdiff) return true;
-    else if ((sn1c > sn2.value()) && (sn1c - sn2.value()) < maxdiff) return true;
-    return false;
+    const T d = static_cast<T>(sn2.value() - sn1.value());
+    P::check(d == maxdiff);
+    return ((d != 0) & (d < maxdiff)) | ((d == maxdiff) & P::tie_less);
 }
 
-// lower-or-equal operator
-template <class T, class U>
-bool operator<= (const SerialNumber<T>& sn1, const SerialNumber<T>& sn2) {
-    return (sn1 == sn2) || (sn1 < sn2); 
+// "greater than" with policy
+template <class P, class T>
+bool serialnumber_greater(const SerialNumber<T>& sn1, const SerialNumber<T>& sn2) {
+    SERIALNUMBER_COUNT_COMPARISON(T, sn1.value(), sn2.value());
+    constexpr T maxdiff = static_cast<T>(1) << ((sizeof(T) * 8) - 1);
+    const T d = static_cast<T>(sn2.value() - sn1.value());
+    P::check(d == maxdiff);
+    return (d > maxdiff) | ((d == maxdiff) & P::tie_greater);
 }
 
-template <class T, class U>
-bool operator<= (const SerialNumber<T>& sn1, U sn2) {
-    return (sn1 == sn2) || (sn1 < sn2); 
+// "lower than", reporting the critical distance via out-parameter
+template <class T>
+bool serialnumber_less(const SerialNumber<T>& sn1, const SerialNumber<T>& sn2, bool& tie) {
+    SERIALNUMBER_COUNT_COMPARISON(T, sn1.value(), sn2.value());
+    constexpr T maxdiff = static_cast<T>(1) << ((sizeof(T) * 8) - 1);
+    const T d = static_cast<T>(sn2.value() - sn1.value());
+    tie = (d == maxdiff);
+    return (d != 0) & (d < maxdiff);
 }
 
-template <class T, class U>
-bool operator<= (T sn1, const SerialNumber<U>& sn2) {
-    return (sn1 == sn2) || (sn1 < sn2); 
+// "greater than", reporting the critical distance via out-parameter
+template <class T>
+bool serialnumber_greater(const SerialNumber<T>& sn1, const SerialNumber<T>& sn2, bool& tie) {
+    SERIALNUMBER_COUNT_COMPARISON(T, sn1.value(), sn2.value());
+    constexpr T maxdiff = static_cast<T>(1) << ((sizeof(T) * 8) - 1);
+    const T d = static_cast<T>(sn2.value() - sn1.value());
+    tie = (d == maxdiff);
+    return d > maxdiff;
 }
 
-// greater-or-equal operator
-template <class T, class U>
-bool operator>= (const SerialNumber<T>& sn1, const SerialNumber<T>& sn2) {
-    return (sn1 == sn2) || (sn1 > sn2); 
-}
+/* Definition of window test functions */
 
-template <class T, class U>
-bool operator>= (const SerialNumber<T>& sn1, U sn2) {
-    return (sn1 == sn2) || (sn1 > sn2); 
+// true if sn is within [start, start + len)
+template <class T>
+bool in_window(const SerialNumber<T>& sn, const SerialNumber<T>& start, T len) {
+    return static_cast<T>(sn.value() - start.value()) < len;
 }
 
-template <class T, class U>
-bool operator>= (T sn1, const SerialNumber<U>& sn2) {
-    return (sn1 == sn2) || (sn1 > sn2); 
+// window test for n values, store 0 or 1 in result, return number within window
+template <class T>
+size_t in_window(const T* sn, size_t n, const SerialNumber<T>& start, T len, uint8_t* result) {
+    const T s = start.value();
+    size_t count = 0;
+    for (size_t i=0; i<n; i++) {
+        result[i] = static_cast<uint8_t>(static_cast<T>(sn[i] - s) < len);
+        count += result[i];
+    }
+    return count;
 }
@@ -0,0 +1,110 @@
+/**
+ @file    SerialNumberQueue.h
+ @brief   Header file for SerialNumberQueue class (multi-producer multi-consumer queue)
+ @author  SerialNumber contributors
+ @version 1.2.0
+ @date    2026-10-16
+ @section license_serialnumber_queue_h License
+  
+ The MIT Licence (MIT)
+ 
+ Copyright (c) 2026 SerialNumber contributors
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+*/
+
+/*
+A SerialNumberQueue is a bounded lock-free queue with a fixed capacity C 
+for any number of producer and consumer threads (after D. Vyukov's 
+bounded MPMC queue).
+
+Each slot carries a sequence ticket, an atomic SerialNumber. Producers
+and consumers claim positions by advancing an atomic SerialNumber cursor
+with compare-and-swap. Comparing the ticket of a slot to the claimed 
+position tells whether the slot is ready:
+
+    producer at position pos:
+        ticket == pos       slot is free, claim pos and write item
+        ticket <  pos       queue is full
+        otherwise           another producer was faster, retry
+
+    consumer at position pos:
+        ticket == pos + 1   slot holds an item, claim pos and read item
+        ticket <  pos + 1   queue is empty
+        otherwise           another consumer was faster, retry
+
+The comparisons use the RFC1982 ordering of SerialNumbers, so tickets and
+cursors may wrap around freely. C must be a power of two and must not 
+exceed 2^(SERIAL_BITS - 2).
+
+The batch versions of push() and pop() process items one by one and stop
+at the first item which can not be added or removed.
+
+This class requires <atomic> and is thus not available on AVR.
+*/
+
+#ifndef SerialNumberQueue_h
+#define SerialNumberQueue_h
+
+#include <atomic>
+#include <stddef.h>
+#include "SerialNumber.h"
+
+/* Declaration of the SerialNumberQueue class template */
+
+template <class Item, size_t C, class T=uint32_t>
+class SerialNumberQueue {
+    public:
+        // constructor
+        SerialNumberQueue(void); ///< constructor
+
+        // not copyable
+        SerialNumberQueue(const SerialNumberQueue&) = delete;            ///< not copyable
+        SerialNumberQueue& operator= (const SerialNumberQueue&) = delete; ///< not copyable
+
+        // add item, return false if queue is full
+        bool push(const Item& item);
+
+        // add up to n items, return number of items added
+        size_t push(const Item* items, size_t n);
+
+        // remove item, return false if queue is empty
+        bool pop(Item& item);
+
+        // remove up to n items, return number of items removed
+        size_t pop(Item* items, size_t n);
+
+        // capacity
+        static constexpr size_t capacity(void) { return C; } ///< capacity
+
+    private:
+        static constexpr size_t line = 64;
+
+        struct Cell {
+            std::atomic<SerialNumber<T> > ticket;
+            Item item;
+        };
+
+        alignas(line) Cell cells[C];
+        alignas(line) std::atomic<SerialNumber<T> > enq;
+        alignas(line) std::atomic<SerialNumber<T> > deq;
+};
+
+#include "SerialNumberQueueClass.hpp"
+
+#endif // SerialNumberQueue_h
@@ -0,0 +1,124 @@
+/**
+ @file    SerialNumberQueueClass.hpp
+ @brief   Implementation file for SerialNumberQueue class (multi-producer multi-consumer queue)
+ @author  SerialNumber contributors
+ @version 1.2.0
+ @date    2026-10-16
+ @section license_serialnumber_queue_class_hpp License
+  
+ The MIT Licence (MIT)
+ 
+ Copyright (c) 2026 SerialNumber contributors
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+*/
+
+/**
+ * @brief  Constructor
+ */
+template <class Item, size_t C, class T>
+SerialNumberQueue<Item, C, T>::SerialNumberQueue(void) : 
+    enq{SerialNumber<T>{T(0)}}, 
+    deq{SerialNumber<T>{T(0)}} {
+    static_assert((C > 0) && ((C & (C - 1)) == 0), "C must be a power of two");
+    static_assert(C <= static_cast<T>(static_cast<T>(1) << ((sizeof(T) * 8) - 2)), "C too large for T");
+    for (size_t i=0; i<C; i++) {
+        cells[i].ticket.store(SerialNumber<T>{static_cast<T>(i)}, std::memory_order_relaxed);
+    }
+}
+
+/**
+ * @brief  Add an item
+ * @param  item  item to add
+ * @return true on success, false if the queue is full
+ */
+template <class Item, size_t C, class T>
+bool SerialNumberQueue<Item, C, T>::push(const Item& item) {
+    SerialNumber<T> pos = enq.load(std::memory_order_relaxed);
+    for (;;) {
+        Cell& cell = cells[pos.value() & (C - 1)];
+        const SerialNumber<T> ticket = cell.ticket.load(std::memory_order_acquire);
+        if (ticket == pos) {
+            if (enq.compare_exchange_weak(pos, SerialNumber<T>{static_cast<T>(pos.value() + 1)}, std::memory_order_relaxed)) {
+                cell.item = item;
+                cell.ticket.store(SerialNumber<T>{static_cast<T>(pos.value() + 1)}, std::memory_order_release);
+                return true;
+            }
+        }
+        else if (ticket < pos) {
+            return false;
+        }
+        else {
+            pos = enq.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+/**
+ * @brief  Add multiple items
+ * @param  items  items to add
+ * @param  n      number of items
+ * @return Number of items added
+ */
+template <class Item, size_t C, class T>
+size_t SerialNumberQueue<Item, C, T>::push(const Item* items, size_t n) {
+    size_t i = 0;
+    while ((i < n) && push(items[i])) i++;
+    return i;
+}
+
+/**
+ * @brief  Remove an item
+ * @param  item  removed item
+ * @return true on success, false if the queue is empty
+ */
+template <class Item, size_t C, class T>
+bool SerialNumberQueue<Item, C, T>::pop(Item& item) {
+    SerialNumber<T> pos = deq.load(std::memory_order_relaxed);
+    for (;;) {
+        Cell& cell = cells[pos.value() & (C - 1)];
+        const SerialNumber<T> ticket = cell.ticket.load(std::memory_order_acquire);
+        const SerialNumber<T> next{static_cast<T>(pos.value() + 1)};
+        if (ticket == next) {
+            if (deq.compare_exchange_weak(pos, next, std::memory_order_relaxed)) {
+                item = cell.item;
+                cell.ticket.store(SerialNumber<T>{static_cast<T>(pos.value() + C)}, std::memory_order_release);
+                return true;
+            }
+        }
+        else if (ticket < next) {
+            return false;
+        }
+        else {
+            pos = deq.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+/**
+ * @brief  Remove multiple items
+ * @param  items  removed items
+ * @param  n      maximum number of items
+ * @return Number of items removed
+ */
+template <class Item, size_t C, class T>
+size_t SerialNumberQueue<Item, C, T>::pop(Item* items, size_t n) {
+    size_t i = 0;
+    while ((i < n) && pop(items[i])) i++;
+    return i;
+}
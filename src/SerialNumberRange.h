@@ -0,0 +1,188 @@
+/**
+ @file    SerialNumberRange.h
+ @brief   Header file for SerialNumberRange class
+ @author  SerialNumber contributors
+ @version 1.2.0
+ @date    2026-10-16
+ @section license_serialnumber_range_h License
+  
+ The MIT Licence (MIT)
+ 
+ Copyright (c) 2026 SerialNumber contributors
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+*/
+
+/*
+A SerialNumberRange is the half-open range [begin, end) of SerialNumbers,
+i.e. begin, begin+1, ..., end-1, possibly wrapping around. A typical use 
+is "retransmit everything from ack+1 to next-1":
+
+    for (SerialNumber<uint16_t> sn : serial_range<uint16_t>(ack.value() + 1, next.value())) {
+        retransmit(sn);
+    }
+
+The size of a range is the modular distance end - begin and is available 
+in O(1). If begin == end, the range is empty. Thus, a range can contain 
+at most 2^SERIAL_BITS - 1 elements.
+
+There is no underlying storage, so dereferencing an iterator returns 
+the SerialNumber by value, and operator-> returns a proxy holding a copy.
+The iterators support all operations of random access iterators (+, -, 
+[], <, ...) in O(1) and are tagged as such, like other iterators with a
+by-value reference (e.g. std::vector<bool>::iterator). Thus, std::distance
+and std::advance take constant time, and the algorithms of the standard 
+library (including parallel execution policies) accept the iterators. 
+With C++20, iterator_concept is random_access_iterator_tag as well, so 
+SerialNumberIterator models std::random_access_iterator. Their 
+difference_type is long long, so ranges of SerialNumber<uint64_t> must 
+not contain more than 2^63 - 1 elements.
+
+On AVR, there is no standard library and thus no iterator_category. The
+iterators still work with range-based for loops.
+*/
+
+#ifndef SerialNumberRange_h
+#define SerialNumberRange_h
+
+#include "SerialNumber.h"
+
+#ifndef __AVR__
+#include <iterator>
+#endif
+
+/* Declaration of the SerialNumberIterator class template */
+
+template <class T>
+class SerialNumberIterator {
+    public:
+        // result of operator->, holds a copy of the current element
+        class ArrowProxy {
+            public:
+                ArrowProxy(const SerialNumber<T>& sn) : v{sn} {}          ///< constructor
+                const SerialNumber<T>* operator-> () const { return &v; } ///< member access
+            private:
+                SerialNumber<T> v;
+        };
+
+#ifndef __AVR__
+        typedef std::random_access_iterator_tag iterator_category; ///< iterator category
+#if __cplusplus >= 202002L
+        typedef std::random_access_iterator_tag iterator_concept;  ///< iterator concept (C++20)
+#endif
+#endif
+        typedef SerialNumber<T> value_type;          ///< value type
+        typedef long long difference_type;           ///< difference type
+        typedef ArrowProxy pointer;                  ///< pointer type
+        typedef SerialNumber<T> reference;           ///< reference type (by value)
+
+        // constructor
+        SerialNumberIterator(T base=T(0), T offset=T(0)); ///< constructor
+
+        // offset from the beginning of the range
+        T offset(void) const;
+
+        // dereference operators
+        reference operator* () const;
+        pointer operator-> () const;
+        value_type operator[] (difference_type n) const;
+
+        // increment and decrement operators
+        SerialNumberIterator& operator++ ();
+        SerialNumberIterator operator++ (int);
+        SerialNumberIterator& operator-- ();
+        SerialNumberIterator operator-- (int);
+
+        // compound assignment operators
+        SerialNumberIterator& operator+= (difference_type n);
+        SerialNumberIterator& operator-= (difference_type n);
+
+    private:
+        T b;               // first element of the range
+        SerialNumber<T> c; // current element
+};
+
+/* Declaration of the SerialNumberRange class template */
+
+template <class T>
+class SerialNumberRange {
+    public:
+        typedef SerialNumberIterator<T> iterator;       ///< iterator type
+        typedef SerialNumberIterator<T> const_iterator; ///< iterator type
+
+        // constructor
+        SerialNumberRange(T first, T last); ///< constructor
+
+        // iterators
+        iterator begin(void) const;
+        iterator end(void) const;
+
+        // number of elements
+        T size(void) const;
+        bool empty(void) const;
+
+    private:
+        T b;
+        T e;
+};
+
+// create range [first, last)
+template <class T>
+SerialNumberRange<T> serial_range(const SerialNumber<T>& first, const SerialNumber<T>& last);
+
+// create range [first, last)
+template <class T>
+SerialNumberRange<T> serial_range(T first, T last);
+
+#include "SerialNumberRangeClass.hpp"
+
+/* Declaration of operators for SerialNumberIterator objects */
+
+template <class T>
+SerialNumberIterator<T> operator+ (SerialNumberIterator<T> it, long long n);
+
+template <class T>
+SerialNumberIterator<T> operator+ (long long n, SerialNumberIterator<T> it);
+
+template <class T>
+SerialNumberIterator<T> operator- (SerialNumberIterator<T> it, long long n);
+
+template <class T>
+long long operator- (const SerialNumberIterator<T>& it1, const SerialNumberIterator<T>& it2);
+
+template <class T>
+bool operator== (const SerialNumberIterator<T>& it1, const SerialNumberIterator<T>& it2);
+
+template <class T>
+bool operator!= (const SerialNumberIterator<T>& it1, const SerialNumberIterator<T>& it2);
+
+template <class T>
+bool operator< (const SerialNumberIterator<T>& it1, const SerialNumberIterator<T>& it2);
+
+template <class T>
+bool operator> (const SerialNumberIterator<T>& it1, const SerialNumberIterator<T>& it2);
+
+template <class T>
+bool operator<= (const SerialNumberIterator<T>& it1, const SerialNumberIterator<T>& it2);
+
+template <class T>
+bool operator>= (const SerialNumberIterator<T>& it1, const SerialNumberIterator<T>& it2);
+
+#include "SerialNumberRangeOperators.hpp"
+
+#endif // SerialNumberRange_h
@@ -0,0 +1,191 @@
+/**
+ @file    SerialNumberRangeClass.hpp
+ @brief   Implementation file for SerialNumberRange class
+ @author  SerialNumber contributors
+ @version 1.2.0
+ @date    2026-10-16
+ @section license_serialnumber_range_class_hpp License
+  
+ The MIT Licence (MIT)
+ 
+ Copyright (c) 2026 SerialNumber contributors
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+*/
+
+/**
+ * @brief  Constructor
+ * @param  base    first element of the range
+ * @param  offset  offset of the current element from base
+ */
+template <class T>
+SerialNumberIterator<T>::SerialNumberIterator(T base, T offset) : b{base}, c{static_cast<T>(base + offset)} {}
+
+/**
+ * @brief  Offset of the current element from the beginning of the range
+ * @return The offset (modular distance)
+ */
+template <class T>
+T SerialNumberIterator<T>::offset(void) const {
+    return static_cast<T>(c.value() - b);
+}
+
+/**
+ * @brief  Dereference operator
+ * @note   Returns the element by value, there is no underlying storage.
+ */
+template <class T>
+typename SerialNumberIterator<T>::reference SerialNumberIterator<T>::operator* () const {
+    return c;
+}
+
+/**
+ * @brief  Member access operator
+ * @note   Returns a proxy holding a copy of the element.
+ */
+template <class T>
+typename SerialNumberIterator<T>::pointer SerialNumberIterator<T>::operator-> () const {
+    return pointer{c};
+}
+
+/**
+ * @brief  Subscript operator
+ * @note   Returns the element by value, there is no underlying storage.
+ */
+template <class T>
+typename SerialNumberIterator<T>::value_type SerialNumberIterator<T>::operator[] (difference_type n) const {
+    return value_type{static_cast<T>(c.value() + static_cast<T>(n))};
+}
+
+/**
+ * @brief  Prefix increment operator
+ */
+template <class T>
+SerialNumberIterator<T>& SerialNumberIterator<T>::operator++ () {
+    ++c;
+    return *this;
+}
+
+/**
+ * @brief  Postfix increment operator
+ */
+template <class T>
+SerialNumberIterator<T> SerialNumberIterator<T>::operator++ (int) {
+    SerialNumberIterator temp{*this};
+    ++c;
+    return temp;
+}
+
+/**
+ * @brief  Prefix decrement operator
+ */
+template <class T>
+SerialNumberIterator<T>& SerialNumberIterator<T>::operator-- () {
+    c = static_cast<T>(c.value() - 1);
+    return *this;
+}
+
+/**
+ * @brief  Postfix decrement operator
+ */
+template <class T>
+SerialNumberIterator<T> SerialNumberIterator<T>::operator-- (int) {
+    SerialNumberIterator temp{*this};
+    c = static_cast<T>(c.value() - 1);
+    return temp;
+}
+
+/**
+ * @brief  Advance iterator by n elements
+ */
+template <class T>
+SerialNumberIterator<T>& SerialNumberIterator<T>::operator+= (difference_type n) {
+    c = static_cast<T>(c.value() + static_cast<T>(n));
+    return *this;
+}
+
+/**
+ * @brief  Move iterator back by n elements
+ */
+template <class T>
+SerialNumberIterator<T>& SerialNumberIterator<T>::operator-= (difference_type n) {
+    c = static_cast<T>(c.value() - static_cast<T>(n));
+    return *this;
+}
+
+/**
+ * @brief  Constructor
+ * @param  first  first element of the range
+ * @param  last   element one past the last element of the range
+ */
+template <class T>
+SerialNumberRange<T>::SerialNumberRange(T first, T last) : b{first}, e{last} {}
+
+/**
+ * @brief  Iterator to the first element of the range
+ */
+template <class T>
+typename SerialNumberRange<T>::iterator SerialNumberRange<T>::begin(void) const {
+    return iterator{b, T(0)};
+}
+
+/**
+ * @brief  Iterator one past the last element of the range
+ */
+template <class T>
+typename SerialNumberRange<T>::iterator SerialNumberRange<T>::end(void) const {
+    return iterator{b, size()};
+}
+
+/**
+ * @brief  Number of elements in the range
+ * @return The modular distance between first and last element
+ */
+template <class T>
+T SerialNumberRange<T>::size(void) const {
+    return static_cast<T>(e - b);
+}
+
+/**
+ * @brief  Check if range is empty
+ * @return true if the range contains no elements
+ */
+template <class T>
+bool SerialNumberRange<T>::empty(void) const {
+    return b == e;
+}
+
+/**
+ * @brief  Create range [first, last)
+ * @param  first  first element of the range
+ * @param  last   element one past the last element of the range
+ */
+template <class T>
+SerialNumberRange<T> serial_range(const SerialNumber<T>& first, const SerialNumber<T>& last) {
+    return SerialNumberRange<T>{first.value(), last.value()};
+}
+
+/**
+ * @brief  Create range [first, last)
+ * @param  first  first element of the range
+ * @param  last   element one past the last element of the range
+ */
+template <class T>
+SerialNumberRange<T> serial_range(T first, T last) {
+    return SerialNumberRange<T>{first, last};
+}
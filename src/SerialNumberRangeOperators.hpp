@@ -0,0 +1,94 @@
+/**
+ @file    SerialNumberRangeOperators.hpp
+ @brief   Implementation file for SerialNumberRange class
+ @author  SerialNumber contributors
+ @version 1.2.0
+ @date    2026-10-16
+ @section license_serialnumber_range_operators_hpp License
+  
+ The MIT Licence (MIT)
+ 
+ Copyright (c) 2026 SerialNumber contributors
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+*/
+
+/* Definition of operators for SerialNumberIterator objects */
+
+/*
+Iterators are ordered by their offset from the beginning of the range,
+not by RFC1982. Comparing iterators from different ranges is undefined.
+*/
+
+// addition operators
+template <class T>
+SerialNumberIterator<T> operator+ (SerialNumberIterator<T> it, long long n) {
+    return it += n;
+}
+
+template <class T>
+SerialNumberIterator<T> operator+ (long long n, SerialNumberIterator<T> it) {
+    return it += n;
+}
+
+// subtraction operators
+template <class T>
+SerialNumberIterator<T> operator- (SerialNumberIterator<T> it, long long n) {
+    return it -= n;
+}
+
+template <class T>
+long long operator- (const SerialNumberIterator<T>& it1, const SerialNumberIterator<T>& it2) {
+    return static_cast<long long>(it1.offset()) - static_cast<long long>(it2.offset());
+}
+
+// equality operator
+template <class T>
+bool operator== (const SerialNumberIterator<T>& it1, const SerialNumberIterator<T>& it2) {
+    return it1.offset() == it2.offset();
+}
+
+// inequality operator
+template <class T>
+bool operator!= (const SerialNumberIterator<T>& it1, const SerialNumberIterator<T>& it2) {
+    return it1.offset() != it2.offset();
+}
+
+// lower-than operator
+template <class T>
+bool operator< (const SerialNumberIterator<T>& it1, const SerialNumberIterator<T>& it2) {
+    return it1.offset() < it2.offset();
+}
+
+// greater-than operator
+template <class T>
+bool operator> (const SerialNumberIterator<T>& it1, const SerialNumberIterator<T>& it2) {
+    return it1.offset() > it2.offset();
+}
+
+// lower-or-equal operator
+template <class T>
+bool operator<= (const SerialNumberIterator<T>& it1, const SerialNumberIterator<T>& it2) {
+    return it1.offset() <= it2.offset();
+}
+
+// greater-or-equal operator
+template <class T>
+bool operator>= (const SerialNumberIterator<T>& it1, const SerialNumberIterator<T>& it2) {
+    return it1.offset() >= it2.offset();
+}
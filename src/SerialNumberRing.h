@@ -0,0 +1,105 @@
+/**
+ @file    SerialNumberRing.h
+ @brief   Header file for SerialNumberRing class (single-producer single-consumer queue)
+ @author  SerialNumber contributors
+ @version 1.2.0
+ @date    2026-10-16
+ @section license_serialnumber_ring_h License
+  
+ The MIT Licence (MIT)
+ 
+ Copyright (c) 2026 SerialNumber contributors
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+*/
+
+/*
+A SerialNumberRing is a lock-free queue with a fixed capacity C for 
+exactly one producer thread and exactly one consumer thread.
+
+The read and write cursors are atomic SerialNumbers which are never reset
+but simply wrap around. The number of items in the queue is the distance
+between the cursors (modulo 2^SERIAL_BITS), which is correct across 
+wrap-around as long as C is at most 2^(SERIAL_BITS - 1):
+
+    empty:  write == read
+    full:   write - read == C
+
+The slot of a cursor is its value modulo C (C must be a power of two).
+
+Each cursor lives on its own cache line. Additionally, the producer keeps
+a private copy of the read cursor and the consumer keeps a private copy
+of the write cursor. The shared cursor of the other side is only loaded 
+if the private copy suggests that the queue is full (or empty, 
+respectively). This keeps cache line transfers between the threads to a
+minimum. push() and pop() are also available for batches of items, 
+which publish all of them with a single atomic store.
+
+This class requires <atomic> and is thus not available on AVR.
+*/
+
+#ifndef SerialNumberRing_h
+#define SerialNumberRing_h
+
+#include <atomic>
+#include <stddef.h>
+#include "SerialNumber.h"
+
+/* Declaration of the SerialNumberRing class template */
+
+template <class Item, size_t C, class T=uint32_t>
+class SerialNumberRing {
+    public:
+        // constructor
+        SerialNumberRing(void); ///< constructor
+
+        // not copyable
+        SerialNumberRing(const SerialNumberRing&) = delete;            ///< not copyable
+        SerialNumberRing& operator= (const SerialNumberRing&) = delete; ///< not copyable
+
+        // producer: add item, return false if queue is full
+        bool push(const Item& item);
+
+        // producer: add up to n items, return number of items added
+        size_t push(const Item* items, size_t n);
+
+        // consumer: remove item, return false if queue is empty
+        bool pop(Item& item);
+
+        // consumer: remove up to n items, return number of items removed
+        size_t pop(Item* items, size_t n);
+
+        // number of items (approximation if called concurrently)
+        size_t size(void) const;
+
+        // capacity
+        static constexpr size_t capacity(void) { return C; } ///< capacity
+
+    private:
+        static constexpr size_t line = 64;
+
+        alignas(line) std::atomic<SerialNumber<T> > wr; // written by producer
+        SerialNumber<T> rd_cache;                       // producer's copy of rd
+        alignas(line) std::atomic<SerialNumber<T> > rd; // written by consumer
+        SerialNumber<T> wr_cache;                       // consumer's copy of wr
+        alignas(line) Item buf[C];
+};
+
+#include "SerialNumberRingClass.hpp"
+
+#endif // SerialNumberRing_h
@@ -0,0 +1,117 @@
+/**
+ @file    SerialNumberRingClass.hpp
+ @brief   Implementation file for SerialNumberRing class (single-producer single-consumer queue)
+ @author  SerialNumber contributors
+ @version 1.2.0
+ @date    2026-10-16
+ @section license_serialnumber_ring_class_hpp License
+  
+ The MIT Licence (MIT)
+ 
+ Copyright (c) 2026 SerialNumber contributors
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+*/
+
+/**
+ * @brief  Constructor
+ */
+template <class Item, size_t C, class T>
+SerialNumberRing<Item, C, T>::SerialNumberRing(void) : 
+    wr{SerialNumber<T>{T(0)}}, 
+    rd_cache{T(0)}, 
+    rd{SerialNumber<T>{T(0)}}, 
+    wr_cache{T(0)} {
+    static_assert((C > 0) && ((C & (C - 1)) == 0), "C must be a power of two");
+    static_assert(C <= static_cast<T>(static_cast<T>(1) << ((sizeof(T) * 8) - 1)), "C too large for T");
+}
+
+/**
+ * @brief  Add an item (producer only)
+ * @param  item  item to add
+ * @return true on success, false if the queue is full
+ */
+template <class Item, size_t C, class T>
+bool SerialNumberRing<Item, C, T>::push(const Item& item) {
+    return push(&item, 1) == 1;
+}
+
+/**
+ * @brief  Add multiple items (producer only)
+ * @param  items  items to add
+ * @param  n      number of items
+ * @return Number of items added
+ */
+template <class Item, size_t C, class T>
+size_t SerialNumberRing<Item, C, T>::push(const Item* items, size_t n) {
+    const SerialNumber<T> w = wr.load(std::memory_order_relaxed);
+    size_t free_slots = C - static_cast<T>(w.value() - rd_cache.value());
+    if (free_slots < n) {
+        rd_cache = rd.load(std::memory_order_acquire);
+        free_slots = C - static_cast<T>(w.value() - rd_cache.value());
+    }
+    if (n > free_slots) n = free_slots;
+    for (size_t i=0; i<n; i++) {
+        buf[static_cast<T>(w.value() + i) & (C - 1)] = items[i];
+    }
+    wr.store(SerialNumber<T>{static_cast<T>(w.value() + n)}, std::memory_order_release);
+    return n;
+}
+
+/**
+ * @brief  Remove an item (consumer only)
+ * @param  item  removed item
+ * @return true on success, false if the queue is empty
+ */
+template <class Item, size_t C, class T>
+bool SerialNumberRing<Item, C, T>::pop(Item& item) {
+    return pop(&item, 1) == 1;
+}
+
+/**
+ * @brief  Remove multiple items (consumer only)
+ * @param  items  removed items
+ * @param  n      maximum number of items
+ * @return Number of items removed
+ */
+template <class Item, size_t C, class T>
+size_t SerialNumberRing<Item, C, T>::pop(Item* items, size_t n) {
+    const SerialNumber<T> r = rd.load(std::memory_order_relaxed);
+    size_t used_slots = static_cast<T>(wr_cache.value() - r.value());
+    if (used_slots < n) {
+        wr_cache = wr.load(std::memory_order_acquire);
+        used_slots = static_cast<T>(wr_cache.value() - r.value());
+    }
+    if (n > used_slots) n = used_slots;
+    for (size_t i=0; i<n; i++) {
+        items[i] = buf[static_cast<T>(r.value() + i) & (C - 1)];
+    }
+    rd.store(SerialNumber<T>{static_cast<T>(r.value() + n)}, std::memory_order_release);
+    return n;
+}
+
+/**
+ * @brief  Number of items in the queue
+ * @note   Only an approximation while producer or consumer are active.
+ */
+template <class Item, size_t C, class T>
+size_t SerialNumberRing<Item, C, T>::size(void) const {
+    const SerialNumber<T> r = rd.load(std::memory_order_acquire);
+    const SerialNumber<T> w = wr.load(std::memory_order_acquire);
+    return static_cast<T>(w.value() - r.value());
+}
@@ -0,0 +1,75 @@
+/**
+ @file    SerialNumberStamp.h
+ @brief   Header file for stamping sequences of SerialNumbers into buffers
+ @author  SerialNumber contributors
+ @version 1.2.0
+ @date    2026-10-16
+ @section license_serialnumber_stamp_h License
+  
+ The MIT Licence (MIT)
+ 
+ Copyright (c) 2026 SerialNumber contributors
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+*/
+
+/*
+stamp_sequence() writes count consecutive SerialNumbers, starting at next,
+into count buffers (e.g. packet headers) located at base, base + stride, 
+base + 2 * stride, and so on. The values are written with the requested
+byte order, regardless of the byte order of the platform and regardless 
+of alignment. Afterwards, next has been advanced by count (modulo 
+2^SERIAL_BITS), i.e. it holds the value to be used for the next packet.
+
+This replaces the pattern of calling operator++ and writing value() for 
+every single packet. next is only read and written once per call, 
+independent of count. Note that this is not an atomic operation. If next
+is shared between threads, protect it accordingly. next is advanced with
+operator++, so with SERIALNUMBER_INSTRUMENTATION (see SerialNumberStats.h)
+every wrap-around caused by stamping is counted.
+*/
+
+#ifndef SerialNumberStamp_h
+#define SerialNumberStamp_h
+
+#include "SerialNumber.h"
+
+/* Declaration of the byte orders */
+
+enum class SerialNumberEndianness {
+    big,    ///< most significant byte first (network byte order)
+    little  ///< least significant byte first
+};
+
+/* Declaration of stamping functions */
+
+// write value in given byte order to dest
+template <class T>
+void stamp_value(void* dest, T value, SerialNumberEndianness order);
+
+// read value in given byte order from src
+template <class T>
+T read_value(const void* src, SerialNumberEndianness order);
+
+// write count consecutive SerialNumbers into strided buffers, advance next
+template <class T>
+void stamp_sequence(SerialNumber<T>& next, void* base, size_t stride, size_t count, SerialNumberEndianness order);
+
+#include "SerialNumberStampFunctions.hpp"
+
+#endif // SerialNumberStamp_h
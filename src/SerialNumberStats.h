@@ -0,0 +1,108 @@
+/**
+ @file    SerialNumberStats.h
+ @brief   Header file for SerialNumberStats class (instrumentation)
+ @author  SerialNumber contributors
+ @version 1.2.0
+ @date    2026-10-16
+ @section license_serialnumber_stats_h License
+  
+ The MIT Licence (MIT)
+ 
+ Copyright (c) 2026 SerialNumber contributors
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+*/
+
+/*
+Optional instrumentation of SerialNumber comparisons and increments.
+
+Define the macro SERIALNUMBER_INSTRUMENTATION before including 
+SerialNumber.h to enable counting. Without the macro, this file is not
+included at all and the hooks in the comparison kernels and the increment
+operators compile to nothing.
+
+For every data type T, SerialNumberStats<T> counts
+
+  - comparisons:  number of "lower than" and "greater than" comparisons
+                  (all other ordering operators are based on these)
+  - wrapped:      comparisons where the result differs from comparing the
+                  plain values, i.e. where wrap-around took effect
+  - ties:         comparisons at the critical distance 2^(SERIAL_BITS - 1)
+  - wraps:        increments from the maximum value to zero
+
+Each thread counts into its own counters, so counting needs no 
+synchronization between threads. SerialNumberStats<T>::get() adds up 
+the counters of all threads (including threads which have already 
+finished). On AVR, there is a single set of plain counters.
+*/
+
+#ifndef SerialNumberStats_h
+#define SerialNumberStats_h
+
+#ifndef __AVR__
+#include <atomic>
+#include <mutex>
+#endif
+
+/* Declaration of the SerialNumberCounters struct */
+
+struct SerialNumberCounters {
+    unsigned long comparisons; ///< number of ordering comparisons
+    unsigned long wrapped;     ///< comparisons where wrap-around took effect
+    unsigned long ties;        ///< comparisons at the critical distance
+    unsigned long wraps;       ///< increments from maximum value to zero
+};
+
+/* Declaration of the SerialNumberStats class template */
+
+template <class T>
+class SerialNumberStats {
+    public:
+        // count a comparison between values i1 and i2
+        static void count_comparison(T i1, T i2);
+
+        // count an increment resulting in value n
+        static void count_increment(T n);
+
+        // counters, added up over all threads
+        static SerialNumberCounters get(void);
+
+    private:
+#ifndef __AVR__
+        // counters of a single thread
+        struct Block {
+            Block(void);
+            ~Block(void);
+            std::atomic<unsigned long> c[4];
+            Block* prev;
+            Block* next;
+        };
+
+        static Block& local(void);
+        static Block*& head(void);
+        static SerialNumberCounters& retired(void);
+        static std::mutex& lock(void);
+#else
+        static SerialNumberCounters& local(void);
+#endif
+        static void add(unsigned int i, unsigned long n);
+};
+
+#include "SerialNumberStatsClass.hpp"
+
+#endif // SerialNumberStats_h
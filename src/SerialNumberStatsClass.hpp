@@ -0,0 +1,178 @@
+/**
+ @file    SerialNumberStatsClass.hpp
+ @brief   Implementation file for SerialNumberStats class (instrumentation)
+ @author  SerialNumber contributors
+ @version 1.2.0
+ @date    2026-10-16
+ @section license_serialnumber_stats_class_hpp License
+  
+ The MIT Licence (MIT)
+ 
+ Copyright (c) 2026 SerialNumber contributors
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+*/
+
+/**
+ * @brief  Count a comparison between two values
+ * @param  i1  first value
+ * @param  i2  second value
+ */
+template <class T>
+void SerialNumberStats<T>::count_comparison(T i1, T i2) {
+    constexpr T maxdiff = static_cast<T>(1) << ((sizeof(T) * 8) - 1);
+    const T d = static_cast<T>(i2 - i1);
+    add(0, 1);
+    // serially lower (0 < d < maxdiff) but numerically greater or vice versa
+    add(1, (d != 0) & (d != maxdiff) & ((d < maxdiff) != (i1 < i2)));
+    add(2, d == maxdiff);
+}
+
+/**
+ * @brief  Count an increment
+ * @param  n  value after the increment
+ */
+template <class T>
+void SerialNumberStats<T>::count_increment(T n) {
+    add(3, n == 0);
+}
+
+#ifndef __AVR__
+
+/**
+ * @brief  Counters, added up over all threads
+ * @return Snapshot of the counters
+ */
+template <class T>
+SerialNumberCounters SerialNumberStats<T>::get(void) {
+    std::lock_guard<std::mutex> guard{lock()};
+    SerialNumberCounters sum = retired();
+    for (Block* b = head(); b != nullptr; b = b->next) {
+        sum.comparisons += b->c[0].load(std::memory_order_relaxed);
+        sum.wrapped     += b->c[1].load(std::memory_order_relaxed);
+        sum.ties        += b->c[2].load(std::memory_order_relaxed);
+        sum.wraps       += b->c[3].load(std::memory_order_relaxed);
+    }
+    return sum;
+}
+
+/**
+ * @brief  Constructor, registers the counters of the calling thread
+ */
+template <class T>
+SerialNumberStats<T>::Block::Block(void) : c{}, prev{nullptr}, next{nullptr} {
+    std::lock_guard<std::mutex> guard{lock()};
+    next = head();
+    if (next != nullptr) next->prev = this;
+    head() = this;
+}
+
+/**
+ * @brief  Destructor, keeps the counts of a finishing thread
+ */
+template <class T>
+SerialNumberStats<T>::Block::~Block(void) {
+    std::lock_guard<std::mutex> guard{lock()};
+    retired().comparisons += c[0].load(std::memory_order_relaxed);
+    retired().wrapped     += c[1].load(std::memory_order_relaxed);
+    retired().ties        += c[2].load(std::memory_order_relaxed);
+    retired().wraps       += c[3].load(std::memory_order_relaxed);
+    if (prev != nullptr) prev->next = next;
+    else head() = next;
+    if (next != nullptr) next->prev = prev;
+}
+
+/**
+ * @brief  Counters of the calling thread
+ */
+template <class T>
+typename SerialNumberStats<T>::Block& SerialNumberStats<T>::local(void) {
+    static thread_local Block b;
+    return b;
+}
+
+/**
+ * @brief  First element of the list of counters of all threads
+ */
+template <class T>
+typename SerialNumberStats<T>::Block*& SerialNumberStats<T>::head(void) {
+    static Block* h = nullptr;
+    return h;
+}
+
+/**
+ * @brief  Counts of threads which have already finished
+ */
+template <class T>
+SerialNumberCounters& SerialNumberStats<T>::retired(void) {
+    static SerialNumberCounters r{0, 0, 0, 0};
+    return r;
+}
+
+/**
+ * @brief  Lock for the list of counters, not used for counting
+ */
+template <class T>
+std::mutex& SerialNumberStats<T>::lock(void) {
+    static std::mutex m;
+    return m;
+}
+
+/**
+ * @brief  Add to a counter of the calling thread
+ * @note   Only the owning thread writes, so there is no need for an
+ *         atomic read-modify-write.
+ */
+template <class T>
+void SerialNumberStats<T>::add(unsigned int i, unsigned long n) {
+    std::atomic<unsigned long>& counter = local().c[i];
+    counter.store(counter.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+}
+
+#else // __AVR__
+
+/**
+ * @brief  Counters
+ * @return Snapshot of the counters
+ */
+template <class T>
+SerialNumberCounters SerialNumberStats<T>::get(void) {
+    return local();
+}
+
+/**
+ * @brief  The counters
+ */
+template <class T>
+SerialNumberCounters& SerialNumberStats<T>::local(void) {
+    static SerialNumberCounters c{0, 0, 0, 0};
+    return c;
+}
+
+/**
+ * @brief  Add to a counter
+ */
+template <class T>
+void SerialNumberStats<T>::add(unsigned int i, unsigned long n) {
+    if      (i == 0) local().comparisons += n;
+    else if (i == 1) local().wrapped += n;
+    else if (i == 2) local().ties += n;
+    else             local().wraps += n;
+}
+
+#endif // __AVR__
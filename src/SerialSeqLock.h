@@ -0,0 +1,118 @@
+/**
+ @file    SerialSeqLock.h
+ @brief   Header file for SerialSeqLock class
+ @author  SerialNumber contributors
+ @version 1.2.0
+ @date    2026-10-16
+ @section license_serialseqlock_h License
+  
+ The MIT Licence (MIT)
+ 
+ Copyright (c) 2026 SerialNumber contributors
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+*/
+
+/*
+A SerialSeqLock publishes snapshots of a Payload from a single writer 
+thread to any number of reader threads. Readers never block the writer
+and never write to shared memory.
+
+The SerialSeqLock has N slots (N must be a power of two). Every write()
+creates a new version of the payload, which is numbered by an atomic 
+SerialNumber. Version v is written to slot v % N, so the writer never 
+touches the N - 1 most recent versions. Each slot carries its own atomic
+SerialNumber stamp: 2 * v while the slot holds version v, and 2 * v - 1 
+(an odd number) while version v is being written to it.
+
+A reader loads the number v of the latest version, copies slot v % N and 
+accepts the copy if and only if the stamp of the slot was 2 * v before and
+after copying. Otherwise, the writer was faster and the reader retries. 
+Version numbers and stamps are compared for equality only, so wrapping
+around is harmless (unless a multiple of 2^(SERIAL_BITS - 1) versions 
+is written during a single read).
+
+With N == 1, this is the classic seqlock. With larger N, a reader only 
+has to retry if the writer publishes N versions while it copies a single 
+one, so writers effectively never stall readers.
+
+Payload must be trivially copyable, as it is copied with memcpy() while
+the writer may be changing it. This is checked at compile time (with the
+compiler builtin where <type_traits> is not available). This class 
+requires <atomic> and is thus not available on AVR.
+*/
+
+#ifndef SerialSeqLock_h
+#define SerialSeqLock_h
+
+#include <atomic>
+#include <stddef.h>
+#include <string.h>
+#include "SerialNumber.h"
+
+#ifndef __AVR__
+#include <type_traits>
+#endif
+
+/* Declaration of the SerialSeqLock class template */
+
+template <class T, class Payload, size_t N=1>
+class SerialSeqLock {
+#ifndef __AVR__
+    static_assert(std::is_trivially_copyable<Payload>::value, "Payload must be trivially copyable");
+#else
+    static_assert(__is_trivially_copyable(Payload), "Payload must be trivially copyable");
+#endif
+
+    public:
+        // constructor
+        SerialSeqLock(const Payload& initial=Payload()); ///< constructor
+
+        // not copyable
+        SerialSeqLock(const SerialSeqLock&) = delete;            ///< not copyable
+        SerialSeqLock& operator= (const SerialSeqLock&) = delete; ///< not copyable
+
+        // writer: publish a new version
+        void write(const Payload& payload);
+
+        // reader: copy latest version, return false if writer interfered
+        bool try_read(Payload& payload) const;
+
+        // reader: copy latest version, retry until successful
+        SerialNumber<T> read(Payload& payload) const;
+
+        // number of the latest version
+        SerialNumber<T> version(void) const;
+
+    private:
+        static constexpr size_t line = 64;
+
+        struct Slot {
+            alignas(line) std::atomic<SerialNumber<T> > stamp;
+            Payload data;
+        };
+
+        bool try_read(Payload& payload, SerialNumber<T>& v) const;
+
+        alignas(line) std::atomic<SerialNumber<T> > latest;
+        Slot slots[N];
+};
+
+#include "SerialSeqLockClass.hpp"
+
+#endif // SerialSeqLock_h
@@ -0,0 +1,109 @@
+/**
+ @file    SerialSeqLockClass.hpp
+ @brief   Implementation file for SerialSeqLock class
+ @author  SerialNumber contributors
+ @version 1.2.0
+ @date    2026-10-16
+ @section license_serialseqlock_class_hpp License
+  
+ The MIT Licence (MIT)
+ 
+ Copyright (c) 2026 SerialNumber contributors
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+*/
+
+/**
+ * @brief  Constructor
+ * @param  initial  payload of version 0
+ */
+template <class T, class Payload, size_t N>
+SerialSeqLock<T, Payload, N>::SerialSeqLock(const Payload& initial) : 
+    latest{SerialNumber<T>{T(0)}} {
+    static_assert((N > 0) && ((N & (N - 1)) == 0), "N must be a power of two");
+    for (size_t i=0; i<N; i++) {
+        slots[i].stamp.store(SerialNumber<T>{T(0)}, std::memory_order_relaxed);
+        slots[i].data = initial;
+    }
+}
+
+/**
+ * @brief  Publish a new version (writer only)
+ * @param  payload  new payload
+ */
+template <class T, class Payload, size_t N>
+void SerialSeqLock<T, Payload, N>::write(const Payload& payload) {
+    const T v = static_cast<T>(latest.load(std::memory_order_relaxed).value() + 1);
+    Slot& slot = slots[v & (N - 1)];
+    slot.stamp.store(SerialNumber<T>{static_cast<T>(2 * v - 1)}, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    memcpy(&slot.data, &payload, sizeof(Payload));
+    slot.stamp.store(SerialNumber<T>{static_cast<T>(2 * v)}, std::memory_order_release);
+    latest.store(SerialNumber<T>{v}, std::memory_order_release);
+}
+
+/**
+ * @brief  Copy latest version (single attempt)
+ * @param  payload  copy of the latest version, unchanged on failure
+ * @return true on success, false if the writer interfered
+ */
+template <class T, class Payload, size_t N>
+bool SerialSeqLock<T, Payload, N>::try_read(Payload& payload) const {
+    SerialNumber<T> v;
+    return try_read(payload, v);
+}
+
+/**
+ * @brief  Copy latest version, retry until successful
+ * @param  payload  copy of the latest version
+ * @return Number of the version copied
+ */
+template <class T, class Payload, size_t N>
+SerialNumber<T> SerialSeqLock<T, Payload, N>::read(Payload& payload) const {
+    SerialNumber<T> v;
+    while (!try_read(payload, v)) {}
+    return v;
+}
+
+/**
+ * @brief  Number of the latest version
+ */
+template <class T, class Payload, size_t N>
+SerialNumber<T> SerialSeqLock<T, Payload, N>::version(void) const {
+    return latest.load(std::memory_order_acquire);
+}
+
+/**
+ * @brief  Copy latest version (single attempt)
+ * @param  payload  copy of the latest version, unchanged on failure
+ * @param  v        number of the version copied
+ * @return true on success, false if the writer interfered
+ */
+template <class T, class Payload, size_t N>
+bool SerialSeqLock<T, Payload, N>::try_read(Payload& payload, SerialNumber<T>& v) const {
+    v = latest.load(std::memory_order_acquire);
+    const Slot& slot = slots[v.value() & (N - 1)];
+    const SerialNumber<T> expected{static_cast<T>(2 * v.value())};
+    if (slot.stamp.load(std::memory_order_acquire) != expected) return false;
+    Payload copy;
+    memcpy(&copy, &slot.data, sizeof(Payload));
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (slot.stamp.load(std::memory_order_relaxed) != expected) return false;
+    payload = copy;
+    return true;
+}
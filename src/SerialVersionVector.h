@@ -0,0 +1,163 @@
+/**
+ @file    SerialVersionVector.h
+ @brief   Header file for SerialVersionVector and SparseSerialVersionVector classes
+ @author  SerialNumber contributors
+ @version 1.2.0
+ @date    2026-10-16
+ @section license_serialversionvector_h License
+  
+ The MIT Licence (MIT)
+ 
+ Copyright (c) 2026 SerialNumber contributors
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+*/
+
+/*
+A version vector (or vector clock) holds one counter per node of a 
+replicated system. Here, the counters are SerialNumbers, so they may wrap
+around. Two version vectors are compared entry by entry according to 
+RFC1982:
+
+ - equal:      all entries are equal
+ - before:     no entry is greater, at least one entry is lower
+ - after:      no entry is lower, at least one entry is greater
+ - concurrent: some entries are lower and some are greater, or at least
+               one pair of entries is at the critical distance 
+               2^(SERIAL_BITS - 1) (which is neither lower nor greater)
+
+An entry for a node which has never been seen is absent. This is not the
+same as an entry with value zero: under RFC1982, half of all values are
+lower than zero, so a zero placeholder would win merges against counters
+which have passed 2^(SERIAL_BITS - 1). An absent entry is lower than any
+present entry, and merging copies one-sided entries unchanged.
+
+SerialVersionVector<T, N> stores N entries in a plain array of T and 
+marks present entries in a second array. The comparison and merge loops
+have no early exits and no branches depending on the data, so the 
+compiler can vectorize them.
+
+SparseSerialVersionVector<T, C, I> is intended for large clusters where
+each vector only contains entries for few nodes. It stores up to C pairs 
+of node id (type I) and counter, sorted by node id. Entries which are not
+stored are absent. Comparison and merge walk both vectors in a single 
+pass.
+
+Neither class allocates memory.
+*/
+
+#ifndef SerialVersionVector_h
+#define SerialVersionVector_h
+
+#include "SerialNumber.h"
+
+// result of comparing two version vectors
+enum class SerialVersionOrder : uint8_t {
+    equal,      ///< all entries are equal
+    before,     ///< first vector happened before the second one
+    after,      ///< first vector happened after the second one
+    concurrent  ///< neither vector happened before the other one
+};
+
+/* Declaration of the SerialVersionVector class template */
+
+template <class T, size_t N>
+class SerialVersionVector {
+    public:
+        // constructor
+        SerialVersionVector(void); ///< constructor
+
+        // number of entries
+        static constexpr size_t size(void) { return N; }
+
+        // getter and setter methods, get returns zero for absent entries
+        bool contains(size_t node) const;
+        SerialNumber<T> get(size_t node) const;
+        void set(size_t node, const SerialNumber<T>& sn);
+
+        // increment the entry of node (local event), return the new value
+        SerialNumber<T> tick(size_t node);
+
+        // entry-wise maximum with other vector
+        SerialVersionVector& merge(const SerialVersionVector& other);
+
+        // compare to other vector
+        SerialVersionOrder compare(const SerialVersionVector& other) const;
+
+        // true if this vector happened after other
+        bool dominates(const SerialVersionVector& other) const;
+
+        // true if neither vector happened before the other one
+        bool concurrent(const SerialVersionVector& other) const;
+
+        // equality operators
+        bool operator== (const SerialVersionVector& other) const;
+        bool operator!= (const SerialVersionVector& other) const;
+
+    private:
+        T c[N];
+        uint8_t p[N]; // 1 if entry is present, 0 if absent
+};
+
+/* Declaration of the SparseSerialVersionVector class template */
+
+template <class T, size_t C, class I=uint16_t>
+class SparseSerialVersionVector {
+    public:
+        // constructor
+        SparseSerialVersionVector(void); ///< constructor
+
+        // number of stored entries and maximum number of entries
+        size_t size(void) const;
+        static constexpr size_t capacity(void) { return C; }
+
+        // getter and setter methods, get returns zero for absent entries,
+        // set returns false if full
+        bool contains(I node) const;
+        SerialNumber<T> get(I node) const;
+        bool set(I node, const SerialNumber<T>& sn);
+
+        // increment the entry of node (local event), return false if full
+        bool tick(I node);
+
+        // entry-wise maximum with other vector, return false if full
+        bool merge(const SparseSerialVersionVector& other);
+
+        // compare to other vector
+        SerialVersionOrder compare(const SparseSerialVersionVector& other) const;
+
+        // true if this vector happened after other
+        bool dominates(const SparseSerialVersionVector& other) const;
+
+        // true if neither vector happened before the other one
+        bool concurrent(const SparseSerialVersionVector& other) const;
+
+        // equality operators
+        bool operator== (const SparseSerialVersionVector& other) const;
+        bool operator!= (const SparseSerialVersionVector& other) const;
+
+    private:
+        size_t find(I node) const;
+        size_t count;
+        I ids[C];
+        T c[C];
+};
+
+#include "SerialVersionVectorClass.hpp"
+
+#endif // SerialVersionVector_h
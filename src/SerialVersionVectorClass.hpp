@@ -0,0 +1,362 @@
+/**
+ @file    SerialVersionVectorClass.hpp
+ @brief   Implementation file for SerialVersionVector and SparseSerialVersionVector classes
+ @author  SerialNumber contributors
+ @version 1.2.0
+ @date    2026-10-16
+ @section license_serialversionvector_class_hpp License
+  
+ The MIT Licence (MIT)
+ 
+ Copyright (c) 2026 SerialNumber contributors
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+*/
+
+/* Helper functions for comparing version vectors */
+
+// accumulate the relation of a pair of entries, without branches
+// (pa and pb are 1 if the entry is present, an absent entry is lower 
+// than any present entry)
+template <class T>
+inline void serialversion_accumulate(T a, T b, unsigned int pa, unsigned int pb, unsigned int& lower, unsigned int& greater, unsigned int& tie) {
+    const unsigned int both = pa & pb;
+    const unsigned int l = both & static_cast<unsigned int>(serialnumber_less(a, b));
+    const unsigned int g = both & static_cast<unsigned int>(serialnumber_greater(a, b));
+    lower |= l | ((pa ^ 1u) & pb);
+    greater |= g | (pa & (pb ^ 1u));
+    tie |= both & static_cast<unsigned int>(a != b) & (l ^ 1u) & (g ^ 1u);
+}
+
+// maximum of a pair of entries (a at the critical distance)
+template <class T>
+inline T serialversion_max(T a, T b) {
+    return serialnumber_less(a, b) ? b : a;
+}
+
+// combine the accumulated relations into the result of the comparison
+inline SerialVersionOrder serialversion_order(unsigned int lower, unsigned int greater, unsigned int tie) {
+    if (tie || (lower && greater)) return SerialVersionOrder::concurrent;
+    if (lower) return SerialVersionOrder::before;
+    if (greater) return SerialVersionOrder::after;
+    return SerialVersionOrder::equal;
+}
+
+/* Definition of SerialVersionVector */
+
+/**
+ * @brief  Constructor, all entries are absent
+ */
+template <class T, size_t N>
+SerialVersionVector<T, N>::SerialVersionVector(void) {
+    for (size_t i=0; i<N; i++) {
+        c[i] = 0;
+        p[i] = 0;
+    }
+}
+
+/**
+ * @brief  True if the entry of a node is present
+ * @param  node  index of the node (0 ... N-1)
+ */
+template <class T, size_t N>
+bool SerialVersionVector<T, N>::contains(size_t node) const {
+    return p[node] != 0;
+}
+
+/**
+ * @brief  Getter function for the entry of a node
+ * @param  node  index of the node (0 ... N-1)
+ * @return The entry, or zero if the entry is absent
+ */
+template <class T, size_t N>
+SerialNumber<T> SerialVersionVector<T, N>::get(size_t node) const {
+    return SerialNumber<T>{c[node]};
+}
+
+/**
+ * @brief  Setter function for the entry of a node
+ * @param  node  index of the node (0 ... N-1)
+ * @param  sn    new value
+ */
+template <class T, size_t N>
+void SerialVersionVector<T, N>::set(size_t node, const SerialNumber<T>& sn) {
+    c[node] = sn.value();
+    p[node] = 1;
+}
+
+/**
+ * @brief  Increment the entry of a node
+ * @param  node  index of the node (0 ... N-1)
+ * @return The new value of the entry (one if the entry was absent)
+ */
+template <class T, size_t N>
+SerialNumber<T> SerialVersionVector<T, N>::tick(size_t node) {
+    SerialNumber<T> sn{c[node]};
+    ++sn;
+    set(node, sn);
+    return sn;
+}
+
+/**
+ * @brief  Entry-wise maximum with other vector
+ * @note   Entries present in only one vector are taken unchanged. 
+ *         Entries at the critical distance are left unchanged.
+ */
+template <class T, size_t N>
+SerialVersionVector<T, N>& SerialVersionVector<T, N>::merge(const SerialVersionVector& other) {
+    for (size_t i=0; i<N; i++) {
+        const T m = p[i] ? serialversion_max(c[i], other.c[i]) : other.c[i];
+        c[i] = other.p[i] ? m : c[i];
+        p[i] = p[i] | other.p[i];
+    }
+    return *this;
+}
+
+/**
+ * @brief  Compare to other vector
+ * @return Order of this vector relative to other
+ */
+template <class T, size_t N>
+SerialVersionOrder SerialVersionVector<T, N>::compare(const SerialVersionVector& other) const {
+    unsigned int lower = 0;
+    unsigned int greater = 0;
+    unsigned int tie = 0;
+    for (size_t i=0; i<N; i++) {
+        serialversion_accumulate(c[i], other.c[i], p[i], other.p[i], lower, greater, tie);
+    }
+    return serialversion_order(lower, greater, tie);
+}
+
+/**
+ * @brief  True if this vector happened after other
+ */
+template <class T, size_t N>
+bool SerialVersionVector<T, N>::dominates(const SerialVersionVector& other) const {
+    return compare(other) == SerialVersionOrder::after;
+}
+
+/**
+ * @brief  True if neither vector happened before the other one
+ */
+template <class T, size_t N>
+bool SerialVersionVector<T, N>::concurrent(const SerialVersionVector& other) const {
+    return compare(other) == SerialVersionOrder::concurrent;
+}
+
+// equality operator
+template <class T, size_t N>
+bool SerialVersionVector<T, N>::operator== (const SerialVersionVector& other) const {
+    bool eq = true;
+    for (size_t i=0; i<N; i++) {
+        eq = eq & (p[i] == other.p[i]) & ((p[i] == 0) | (c[i] == other.c[i]));
+    }
+    return eq;
+}
+
+// inequality operator
+template <class T, size_t N>
+bool SerialVersionVector<T, N>::operator!= (const SerialVersionVector& other) const {
+    return !(*this == other);
+}
+
+/* Definition of SparseSerialVersionVector */
+
+/**
+ * @brief  Constructor, all entries are absent
+ */
+template <class T, size_t C, class I>
+SparseSerialVersionVector<T, C, I>::SparseSerialVersionVector(void) : count{0} {}
+
+/**
+ * @brief  Number of stored entries
+ */
+template <class T, size_t C, class I>
+size_t SparseSerialVersionVector<T, C, I>::size(void) const {
+    return count;
+}
+
+/**
+ * @brief  Position of the first stored entry with id not lower than node
+ */
+template <class T, size_t C, class I>
+size_t SparseSerialVersionVector<T, C, I>::find(I node) const {
+    size_t lo = 0;
+    size_t hi = count;
+    while (lo < hi) {
+        const size_t mid = lo + (hi - lo) / 2;
+        if (ids[mid] < node) lo = mid + 1;
+        else hi = mid;
+    }
+    return lo;
+}
+
+/**
+ * @brief  True if there is an entry for node
+ */
+template <class T, size_t C, class I>
+bool SparseSerialVersionVector<T, C, I>::contains(I node) const {
+    const size_t pos = find(node);
+    return (pos < count) && (ids[pos] == node);
+}
+
+/**
+ * @brief  Getter function for the entry of a node
+ * @return The entry, or zero if there is no entry for node
+ */
+template <class T, size_t C, class I>
+SerialNumber<T> SparseSerialVersionVector<T, C, I>::get(I node) const {
+    const size_t pos = find(node);
+    if ((pos < count) && (ids[pos] == node)) return SerialNumber<T>{c[pos]};
+    return SerialNumber<T>{0};
+}
+
+/**
+ * @brief  Setter function for the entry of a node
+ * @return false if a new entry would be needed, but the vector is full
+ */
+template <class T, size_t C, class I>
+bool SparseSerialVersionVector<T, C, I>::set(I node, const SerialNumber<T>& sn) {
+    const size_t pos = find(node);
+    if ((pos < count) && (ids[pos] == node)) {
+        c[pos] = sn.value();
+        return true;
+    }
+    if (count == C) return false;
+    for (size_t i=count; i>pos; i--) {
+        ids[i] = ids[i-1];
+        c[i] = c[i-1];
+    }
+    ids[pos] = node;
+    c[pos] = sn.value();
+    count++;
+    return true;
+}
+
+/**
+ * @brief  Increment the entry of a node (a new entry starts at one)
+ * @return false if a new entry would be needed, but the vector is full
+ */
+template <class T, size_t C, class I>
+bool SparseSerialVersionVector<T, C, I>::tick(I node) {
+    SerialNumber<T> sn = get(node);
+    ++sn;
+    return set(node, sn);
+}
+
+/**
+ * @brief  Entry-wise maximum with other vector
+ * @return false if the result does not fit into the vector. In this case,
+ *         the vector is left unchanged.
+ * @note   Entries present in only one vector are taken unchanged. 
+ *         Entries at the critical distance are left unchanged.
+ */
+template <class T, size_t C, class I>
+bool SparseSerialVersionVector<T, C, I>::merge(const SparseSerialVersionVector& other) {
+    // number of entries of the result
+    size_t n = count + other.count;
+    for (size_t i=0, j=0; (i < count) && (j < other.count); ) {
+        if (ids[i] < other.ids[j]) i++;
+        else if (other.ids[j] < ids[i]) j++;
+        else { n--; i++; j++; }
+    }
+    if (n > C) return false;
+
+    // merge in place, starting at the end
+    size_t i = count;
+    size_t j = other.count;
+    size_t k = n;
+    while (j > 0) {
+        k--;
+        if ((i > 0) && (other.ids[j-1] < ids[i-1])) {
+            i--;
+            ids[k] = ids[i];
+            c[k] = c[i];
+        }
+        else if ((i > 0) && (ids[i-1] == other.ids[j-1])) {
+            i--;
+            j--;
+            ids[k] = ids[i];
+            c[k] = serialversion_max(c[i], other.c[j]);
+        }
+        else {
+            j--;
+            ids[k] = other.ids[j];
+            c[k] = other.c[j];
+        }
+    }
+    count = n;
+    return true;
+}
+
+/**
+ * @brief  Compare to other vector
+ * @return Order of this vector relative to other
+ */
+template <class T, size_t C, class I>
+SerialVersionOrder SparseSerialVersionVector<T, C, I>::compare(const SparseSerialVersionVector& other) const {
+    unsigned int lower = 0;
+    unsigned int greater = 0;
+    unsigned int tie = 0;
+    size_t i = 0;
+    size_t j = 0;
+    while ((i < count) || (j < other.count)) {
+        if ((j == other.count) || ((i < count) && (ids[i] < other.ids[j]))) {
+            greater = 1;
+            i++;
+        }
+        else if ((i == count) || (other.ids[j] < ids[i])) {
+            lower = 1;
+            j++;
+        }
+        else {
+            serialversion_accumulate(c[i], other.c[j], 1u, 1u, lower, greater, tie);
+            i++;
+            j++;
+        }
+    }
+    return serialversion_order(lower, greater, tie);
+}
+
+/**
+ * @brief  True if this vector happened after other
+ */
+template <class T, size_t C, class I>
+bool SparseSerialVersionVector<T, C, I>::dominates(const SparseSerialVersionVector& other) const {
+    return compare(other) == SerialVersionOrder::after;
+}
+
+/**
+ * @brief  True if neither vector happened before the other one
+ */
+template <class T, size_t C, class I>
+bool SparseSerialVersionVector<T, C, I>::concurrent(const SparseSerialVersionVector& other) const {
+    return compare(other) == SerialVersionOrder::concurrent;
+}
+
+// equality operator (same entries present, with equal values)
+template <class T, size_t C, class I>
+bool SparseSerialVersionVector<T, C, I>::operator== (const SparseSerialVersionVector& other) const {
+    return compare(other) == SerialVersionOrder::equal;
+}
+
+// inequality operator
+template <class T, size_t C, class I>
+bool SparseSerialVersionVector<T, C, I>::operator!= (const SparseSerialVersionVector& other) const {
+    return !(*this == other);
+}
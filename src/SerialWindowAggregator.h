@@ -0,0 +1,135 @@
+/**
+ @file    SerialWindowAggregator.h
+ @brief   Header file for SerialWindowAggregator class
+ @author  SerialNumber contributors
+ @version 1.2.0
+ @date    2026-10-16
+ @section license_serialwindowaggregator_h License
+  
+ The MIT Licence (MIT)
+ 
+ Copyright (c) 2026 SerialNumber contributors
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+*/
+
+/*
+A SerialWindowAggregator maintains an aggregate (e.g. sum of bytes, 
+number of packets, maximum latency) over the values added for the last W
+SerialNumbers, counting back from the highest SerialNumber seen. Values 
+for SerialNumbers which fall out of this window are evicted in RFC1982 
+order.
+
+The aggregation is defined by a class Agg, which has to provide a 
+commutative monoid:
+
+    typedef ... value_type;
+    static value_type identity(void);
+    static value_type combine(value_type a, value_type b);
+
+SerialWindowSum<V>, SerialWindowMin<V> and SerialWindowMax<V> are ready
+to use. Count the values by adding 1 with SerialWindowSum.
+
+The values of the window are kept in a ring of W slots, indexed by
+SerialNumber modulo W. To get the aggregate of the window in O(1), the 
+ring is split into two parts, like a queue built from two stacks: For 
+the older part, the aggregates of all slots up to the newest slot of the 
+part are kept (the "front stack"). For the newer part, only a single 
+aggregate is kept (the "back stack"). Evicting a slot drops it from the 
+front; when the front is empty, it is rebuilt from all slots in O(W). 
+Thus, adding a value for a new SerialNumber takes O(1) amortized time. 
+Adding a value for an older SerialNumber still within the window (a late 
+arrival) is O(1) if it lies in the back part. If it lies in the front 
+part, the front aggregates from its slot down to the oldest slot of the 
+window are rebuilt, which takes time proportional to W minus its age: 
+the oldest late arrivals are the cheapest.
+
+The aggregator does not allocate memory. W must be a power of two and 
+must not be greater than 2^(SERIAL_BITS - 1).
+*/
+
+#ifndef SerialWindowAggregator_h
+#define SerialWindowAggregator_h
+
+#include "SerialNumber.h"
+
+/* Declaration of the SerialWindowAggregator class template */
+
+template <class T, class Agg, size_t W>
+class SerialWindowAggregator {
+    public:
+        typedef typename Agg::value_type value_type; ///< type of values and aggregate
+
+        // constructor
+        SerialWindowAggregator(void); ///< constructor
+
+        // add value for sn, return false if sn is too old
+        bool add(const SerialNumber<T>& sn, value_type v);
+
+        // aggregate over the window
+        value_type aggregate(void) const;
+
+        // aggregate of the values added for sn
+        value_type get(const SerialNumber<T>& sn) const;
+
+        // highest SerialNumber seen so far
+        SerialNumber<T> highest(void) const;
+
+        // forget everything
+        void reset(void);
+
+    private:
+        void start(T sn);
+        void advance(T d);
+        void flip(void);
+        bool in_back(T sn) const;
+
+        value_type vals[W];
+        value_type front[W];
+        value_type back;
+        SerialNumber<T> hi;
+        T mid;
+        bool started;
+};
+
+/* Declaration of aggregation classes */
+
+template <class V>
+struct SerialWindowSum {
+    typedef V value_type;                                                    ///< type of values
+    static V identity(void) { return V(0); }                                 ///< neutral element
+    static V combine(V a, V b) { return static_cast<V>(a + b); }             ///< sum
+};
+
+template <class V>
+struct SerialWindowMin {
+    typedef V value_type;                                                    ///< type of values
+    static V identity(void) { return static_cast<V>(~static_cast<V>(0)); }   ///< neutral element (unsigned V)
+    static V combine(V a, V b) { return (b < a) ? b : a; }                   ///< minimum
+};
+
+template <class V>
+struct SerialWindowMax {
+    typedef V value_type;                                                    ///< type of values
+    static V identity(void) { return V(0); }                                 ///< neutral element (unsigned V)
+    static V combine(V a, V b) { return (a < b) ? b : a; }                   ///< maximum
+};
+
+#include "SerialWindowAggregatorClass.hpp"
+
+#endif // SerialWindowAggregator_h
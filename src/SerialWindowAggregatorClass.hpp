@@ -0,0 +1,167 @@
+/**
+ @file    SerialWindowAggregatorClass.hpp
+ @brief   Implementation file for SerialWindowAggregator class
+ @author  SerialNumber contributors
+ @version 1.2.0
+ @date    2026-10-16
+ @section license_serialwindowaggregator_class_hpp License
+  
+ The MIT Licence (MIT)
+ 
+ Copyright (c) 2026 SerialNumber contributors
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+*/
+
+/**
+ * @brief  Constructor
+ */
+template <class T, class Agg, size_t W>
+SerialWindowAggregator<T, Agg, W>::SerialWindowAggregator(void) {
+    static_assert((W >= 1) && ((W & (W - 1)) == 0), "W must be a power of two");
+    static_assert((W - 1) < static_cast<T>(static_cast<T>(1) << ((sizeof(T) * 8) - 1)), "W too large for T");
+    reset();
+}
+
+/**
+ * @brief  Add a value for a SerialNumber
+ * @param  sn  SerialNumber the value belongs to
+ * @param  v   value
+ * @return true if the value was added, false if sn is too old
+ */
+template <class T, class Agg, size_t W>
+bool SerialWindowAggregator<T, Agg, W>::add(const SerialNumber<T>& sn, value_type v) {
+    if (!started) {
+        start(sn.value());
+    }
+    else if (sn > hi) {
+        advance(static_cast<T>(sn.value() - hi.value()));
+    }
+    else if (static_cast<T>(hi.value() - sn.value()) >= W) {
+        // too old (or at critical distance)
+        return false;
+    }
+
+    const T s = sn.value();
+    vals[s & (W - 1)] = Agg::combine(vals[s & (W - 1)], v);
+    if (in_back(s)) {
+        back = Agg::combine(back, v);
+    }
+    else {
+        // late arrival in front part: rebuild front aggregates down to oldest slot
+        const T lo = static_cast<T>(hi.value() - (W - 1));
+        for (T p = s; ; p--) {
+            const value_type next = (static_cast<T>(p + 1) == mid) ? Agg::identity() : front[(p + 1) & (W - 1)];
+            front[p & (W - 1)] = Agg::combine(vals[p & (W - 1)], next);
+            if (p == lo) break;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief  Aggregate over all values in the window
+ */
+template <class T, class Agg, size_t W>
+typename SerialWindowAggregator<T, Agg, W>::value_type SerialWindowAggregator<T, Agg, W>::aggregate(void) const {
+    const T lo = static_cast<T>(hi.value() - (W - 1));
+    const value_type f = (lo == mid) ? Agg::identity() : front[lo & (W - 1)];
+    return Agg::combine(f, back);
+}
+
+/**
+ * @brief  Aggregate of the values added for a SerialNumber
+ * @return identity if sn is not within the window
+ */
+template <class T, class Agg, size_t W>
+typename SerialWindowAggregator<T, Agg, W>::value_type SerialWindowAggregator<T, Agg, W>::get(const SerialNumber<T>& sn) const {
+    if (!started || (sn > hi) || (static_cast<T>(hi.value() - sn.value()) >= W)) return Agg::identity();
+    return vals[sn.value() & (W - 1)];
+}
+
+/**
+ * @brief  Highest SerialNumber seen so far
+ */
+template <class T, class Agg, size_t W>
+SerialNumber<T> SerialWindowAggregator<T, Agg, W>::highest(void) const {
+    return hi;
+}
+
+/**
+ * @brief  Forget all values
+ */
+template <class T, class Agg, size_t W>
+void SerialWindowAggregator<T, Agg, W>::reset(void) {
+    start(0);
+    started = false;
+}
+
+/**
+ * @brief  Start with an empty window ending at sn
+ */
+template <class T, class Agg, size_t W>
+void SerialWindowAggregator<T, Agg, W>::start(T sn) {
+    for (size_t i=0; i<W; i++) {
+        vals[i] = Agg::identity();
+        front[i] = Agg::identity();
+    }
+    back = Agg::identity();
+    hi = sn;
+    mid = sn;
+    started = true;
+}
+
+/**
+ * @brief  Move the window forward by d SerialNumbers, evicting old slots
+ */
+template <class T, class Agg, size_t W>
+void SerialWindowAggregator<T, Agg, W>::advance(T d) {
+    if (d >= W) {
+        start(static_cast<T>(hi.value() + d));
+        return;
+    }
+    for (T k=0; k<d; k++) {
+        // the oldest slot is evicted and reused for the new SerialNumber
+        if (static_cast<T>(hi.value() - (W - 1)) == mid) flip();
+        ++hi;
+        vals[hi.value() & (W - 1)] = Agg::identity();
+    }
+}
+
+/**
+ * @brief  Move all slots to the front part
+ */
+template <class T, class Agg, size_t W>
+void SerialWindowAggregator<T, Agg, W>::flip(void) {
+    value_type acc = Agg::identity();
+    for (T p = hi.value(); ; p--) {
+        acc = Agg::combine(vals[p & (W - 1)], acc);
+        front[p & (W - 1)] = acc;
+        if (p == mid) break;
+    }
+    mid = static_cast<T>(hi.value() + 1);
+    back = Agg::identity();
+}
+
+/**
+ * @brief  True if sn is within the back part [mid, hi]
+ */
+template <class T, class Agg, size_t W>
+bool SerialWindowAggregator<T, Agg, W>::in_back(T sn) const {
+    return static_cast<T>(sn - mid) <= static_cast<T>(hi.value() - mid);
+}
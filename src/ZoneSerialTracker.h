@@ -0,0 +1,104 @@
+/**
+ @file    ZoneSerialTracker.h
+ @brief   Header file for ZoneSerialTracker class
+ @author  SerialNumber contributors
+ @version 1.2.0
+ @date    2026-10-16
+ @section license_zoneserialtracker_h License
+  
+ The MIT Licence (MIT)
+ 
+ Copyright (c) 2026 SerialNumber contributors
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+*/
+
+/*
+RFC1982 was written for the SOA serials of DNS zones. A secondary name 
+server transfers a zone from the primary (AXFR/IXFR) if the serial in a 
+NOTIFY message or in the answer to an SOA query is greater than the 
+serial of its own copy of the zone.
+
+A ZoneSerialTracker keeps the serials of many zones in two columns 
+(structure of arrays) provided by the caller:
+
+    T serials[zones];        // serial of the local copy of each zone
+    uint8_t pending[zones];  // 1 if a zone transfer is needed, 0 if not
+
+Zones are identified by their index into these arrays. Incoming serials
+are evaluated one by one (notify()), for a list of zones (notify() with
+arrays of zones and serials), or for a contiguous block of zones 
+(evaluate()). evaluate() has no data-dependent branches, so the compiler
+can vectorize it. Once a zone transfer is completed, set_serial() stores 
+the new serial and clears the pending flag.
+
+serial_reset_step() helps to move the serial of a zone to a value which
+is lower than the current one (RFC1982, section 7): the serial can only 
+be increased by up to 2^(SERIAL_BITS - 1) - 1 at a time, and each step
+must have propagated to all secondaries before the next one is taken.
+*/
+
+#ifndef ZoneSerialTracker_h
+#define ZoneSerialTracker_h
+
+#include "SerialNumber.h"
+
+/* Declaration of the ZoneSerialTracker class template */
+
+template <class T=uint32_t>
+class ZoneSerialTracker {
+    public:
+        // constructor
+        ZoneSerialTracker(T* serials, uint8_t* pending, size_t zones); ///< constructor
+
+        // number of zones
+        size_t size(void) const;
+
+        // serial of the local copy of a zone
+        SerialNumber<T> serial(size_t zone) const;
+
+        // store serial after a completed zone transfer, clear pending flag
+        void set_serial(size_t zone, const SerialNumber<T>& sn);
+
+        // true if zone transfer is needed for zone
+        bool pending(size_t zone) const;
+
+        // evaluate incoming serial for zone, return true if transfer is needed
+        bool notify(size_t zone, const SerialNumber<T>& remote);
+
+        // evaluate incoming serials for n zones, return number of zones needing a transfer
+        size_t notify(const size_t* zones, const T* remote, size_t n);
+
+        // evaluate incoming serials for zones first ... first+n-1, return number of zones needing a transfer
+        size_t evaluate(size_t first, const T* remote, size_t n);
+
+    private:
+        T* s;
+        uint8_t* p;
+        size_t cnt;
+};
+
+/* Declaration of helper function for serial number reset */
+
+// next serial to publish on the way from current to target
+template <class T>
+SerialNumber<T> serial_reset_step(const SerialNumber<T>& current, const SerialNumber<T>& target);
+
+#include "ZoneSerialTrackerClass.hpp"
+
+#endif // ZoneSerialTracker_h
@@ -0,0 +1,143 @@
+/**
+ @file    ZoneSerialTrackerClass.hpp
+ @brief   Implementation file for ZoneSerialTracker class
+ @author  SerialNumber contributors
+ @version 1.2.0
+ @date    2026-10-16
+ @section license_zoneserialtracker_class_hpp License
+  
+ The MIT Licence (MIT)
+ 
+ Copyright (c) 2026 SerialNumber contributors
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+*/
+
+/**
+ * @brief  Constructor
+ * @param  serials  array of zone serials, not copied
+ * @param  pending  array of pending flags, not copied
+ * @param  zones    number of elements of both arrays
+ * @note   The arrays are not initialized by the constructor.
+ */
+template <class T>
+ZoneSerialTracker<T>::ZoneSerialTracker(T* serials, uint8_t* pending, size_t zones) : 
+    s{serials}, p{pending}, cnt{zones} {}
+
+/**
+ * @brief  Number of zones
+ */
+template <class T>
+size_t ZoneSerialTracker<T>::size(void) const {
+    return cnt;
+}
+
+/**
+ * @brief  Serial of the local copy of a zone
+ */
+template <class T>
+SerialNumber<T> ZoneSerialTracker<T>::serial(size_t zone) const {
+    return SerialNumber<T>{s[zone]};
+}
+
+/**
+ * @brief  Store serial after a completed zone transfer
+ * @note   The pending flag is cleared.
+ */
+template <class T>
+void ZoneSerialTracker<T>::set_serial(size_t zone, const SerialNumber<T>& sn) {
+    s[zone] = sn.value();
+    p[zone] = 0;
+}
+
+/**
+ * @brief  True if a zone transfer is needed for a zone
+ */
+template <class T>
+bool ZoneSerialTracker<T>::pending(size_t zone) const {
+    return p[zone] != 0;
+}
+
+/**
+ * @brief  Evaluate incoming serial (NOTIFY or SOA answer) for a zone
+ * @return true if a zone transfer is needed
+ * @note   A pending flag is only cleared by set_serial().
+ */
+template <class T>
+bool ZoneSerialTracker<T>::notify(size_t zone, const SerialNumber<T>& remote) {
+    p[zone] |= static_cast<uint8_t>(serialnumber_greater(remote.value(), s[zone]));
+    return p[zone] != 0;
+}
+
+/**
+ * @brief  Evaluate incoming serials for a list of zones
+ * @param  zones   array of n zone indices
+ * @param  remote  array of n incoming serials
+ * @param  n       number of zones
+ * @return Number of the listed zones which need a zone transfer
+ */
+template <class T>
+size_t ZoneSerialTracker<T>::notify(const size_t* zones, const T* remote, size_t n) {
+    size_t needed = 0;
+    for (size_t i=0; i<n; i++) {
+        const size_t z = zones[i];
+        p[z] |= static_cast<uint8_t>(serialnumber_greater(remote[i], s[z]));
+        needed += p[z];
+    }
+    return needed;
+}
+
+/**
+ * @brief  Evaluate incoming serials for a contiguous block of zones
+ * @param  first   index of first zone
+ * @param  remote  array of n incoming serials for zones first ... first+n-1
+ * @param  n       number of zones
+ * @return Number of zones in the block which need a zone transfer
+ */
+template <class T>
+size_t ZoneSerialTracker<T>::evaluate(size_t first, const T* remote, size_t n) {
+    T* const sb = s + first;
+    uint8_t* const pb = p + first;
+    size_t needed = 0;
+    for (size_t i=0; i<n; i++) {
+        pb[i] |= static_cast<uint8_t>(serialnumber_greater(remote[i], sb[i]));
+        needed += pb[i];
+    }
+    return needed;
+}
+
+/**
+ * @brief  Next serial to publish on the way from current to target
+ * @param  current  serial currently published
+ * @param  target   serial which shall be published eventually
+ * @return target if it is greater than or equal to current, otherwise 
+ *         current increased by the largest allowed step 
+ *         2^(SERIAL_BITS - 1) - 1
+ * @note   Publish the returned serial, wait until all secondaries have
+ *         picked it up, and repeat until target is returned. At most two
+ *         intermediate serials are needed: one in general, two if target
+ *         is current - 1 (after the first step, target is exactly at the
+ *         critical distance).
+ */
+template <class T>
+SerialNumber<T> serial_reset_step(const SerialNumber<T>& current, const SerialNumber<T>& target) {
+    constexpr T maxstep = static_cast<T>((static_cast<T>(1) << ((sizeof(T) * 8) - 1)) - 1);
+    if (target == current) return target;
+    if (serialnumber_greater(target.value(), current.value())) return target;
+    return SerialNumber<T>{static_cast<T>(current.value() + maxstep)};
+}
@@ -0,0 +1,73 @@
+/*
+Benchmark of the throughput of atomic_serial_max() on a single
+std::atomic<SerialNumber<uint32_t> > versus ShardedSerialMax<uint32_t, 16>
+with 1 ... 64 writer threads.
+
+The writers report interleaved, increasing acknowledgements starting
+close to the wrap-around point of uint32_t, so most updates succeed and
+write. The time is given per update (wall-clock time divided by the total
+number of updates of all writers), so lower is better and perfect
+scaling shows as a time per update which falls with the number of
+threads, up to the number of cores. At the end, the maximum must be the
+highest value reported.
+*/
+
+#include <stdint.h>
+#include <stddef.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include "bench_common.h"
+#include "SerialNumberAtomic.h"
+
+static const uint32_t UPDATES = 1u << 22; // all writers together
+static const uint32_t FIRST = 0xFFF00000u;
+
+// start threads writers, each calling update(t, sn) for its values
+template <class F>
+static void writers(unsigned threads, F update) {
+    std::atomic<bool> go{false};
+    std::vector<std::thread> pool;
+    for (unsigned t=0; t<threads; t++) {
+        pool.emplace_back([t, threads, &go, &update] {
+            while (!go.load(std::memory_order_acquire)) std::this_thread::yield();
+            for (uint32_t i=t; i<UPDATES; i+=threads) {
+                update(t, SerialNumber<uint32_t>{static_cast<uint32_t>(FIRST + i)});
+            }
+        });
+    }
+    go.store(true, std::memory_order_release);
+    for (std::thread& th : pool) th.join();
+}
+
+int main() {
+    const SerialNumber<uint32_t> expected{static_cast<uint32_t>(FIRST + UPDATES - 1)};
+    int failed = 0;
+    printf("%-16s %-40s %10u\n", "ack tracking", "hardware threads", std::thread::hardware_concurrency());
+    for (unsigned threads=1; threads<=64; threads*=2) {
+        char variant[64];
+
+        snprintf(variant, sizeof(variant), "atomic_serial_max, %u writers", threads);
+        bench_run("ack tracking", variant, UPDATES, [threads, &expected, &failed] {
+            std::atomic<SerialNumber<uint32_t> > a{SerialNumber<uint32_t>{FIRST}};
+            writers(threads, [&a](unsigned, const SerialNumber<uint32_t>& sn) {
+                atomic_serial_max(a, sn);
+            });
+            if (a.load() != expected) failed = 1;
+            return static_cast<uint64_t>(a.load().value());
+        });
+
+        snprintf(variant, sizeof(variant), "ShardedSerialMax<16>, %u writers", threads);
+        bench_run("ack tracking", variant, UPDATES, [threads, &expected, &failed] {
+            ShardedSerialMax<uint32_t, 16> m{SerialNumber<uint32_t>{FIRST}};
+            writers(threads, [&m](unsigned t, const SerialNumber<uint32_t>& sn) {
+                m.update(t, sn);
+            });
+            const SerialNumber<uint32_t> v = m.get();
+            if (v != expected) failed = 1;
+            return static_cast<uint64_t>(v.value());
+        });
+    }
+    if (failed) printf("ERROR: wrong maximum\n");
+    return failed;
+}
@@ -0,0 +1,62 @@
+/*
+Common helpers for the host benchmarks: a monotonic clock, a sink which
+keeps the compiler from optimizing measured loops away, a pseudo-random
+generator and a uniform output format.
+
+Each benchmark prints one line per measurement:
+
+    <benchmark> <variant> <ns per operation> ns/op
+
+Timings are the best of a few repetitions, which filters out most of the
+noise of a shared host. They are only meaningful relative to each other.
+*/
+
+#ifndef bench_common_h
+#define bench_common_h
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <chrono>
+
+// number of repetitions of each measurement, the fastest one is reported
+static const unsigned BENCH_REPEAT = 5;
+
+// results are added to this, so measured loops are never dead code
+static volatile uint64_t bench_sink = 0;
+
+// monotonic time in nanoseconds
+static inline double bench_now(void) {
+    return std::chrono::duration<double, std::nano>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// xorshift64, deterministic across runs
+struct BenchRandom {
+    uint64_t s;
+    explicit BenchRandom(uint64_t seed=0x9E3779B97F4A7C15ull) : s{seed} {}
+    uint64_t next(void) {
+        s ^= s << 13;
+        s ^= s >> 7;
+        s ^= s << 17;
+        return s;
+    }
+};
+
+// time f() (which performs ops operations and returns a checksum),
+// print the best time per operation and return it
+template <class F>
+double bench_run(const char* name, const char* variant, uint64_t ops, F f) {
+    double best = 0;
+    for (unsigned r=0; r<BENCH_REPEAT; r++) {
+        const double start = bench_now();
+        bench_sink = bench_sink + f();
+        const double t = (bench_now() - start) / static_cast<double>(ops);
+        if ((r == 0) || (t < best)) best = t;
+    }
+    printf("%-16s %-40s %10.3f ns/op\n", name, variant, best);
+    fflush(stdout);
+    return best;
+}
+
+#endif // bench_common_h
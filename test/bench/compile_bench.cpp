@@ -0,0 +1,116 @@
+/*
+Benchmark of the compile-time cost of SerialNumber.h.
+
+The driver generates translation units and times the compiler on them
+(-c -O0, as in a typical debug build of a large project):
+
+ - plain:     N functions comparing plain integers (the baseline)
+ - include:   only #include "SerialNumber.h"
+ - operators: N functions, each using all six comparison operators in all
+              three shapes (SerialNumber vs SerialNumber, SerialNumber vs
+              T, T vs SerialNumber), cycling through uint8_t ... uint64_t
+ - strict:    the same with SERIALNUMBER_STRICT, which adds the deleted
+              overloads for other types
+
+The difference between operators and plain is the cost of the header and
+of overload resolution for 18 * N comparisons.
+
+The compiler is taken from the environment variable CXX (default c++),
+the include directory from BENCH_SRC and the scratch directory from
+BENCH_TMP (both set by run_bench.sh).
+*/
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+#include "bench_common.h"
+
+static const unsigned N = 1000;
+static const unsigned COMPILES = 3;
+
+static const char* env(const char* name, const char* fallback) {
+    const char* v = getenv(name);
+    return ((v != nullptr) && (v[0] != '\0')) ? v : fallback;
+}
+
+// write a translation unit, return false on error
+static bool generate(const std::string& path, bool serial, bool strict) {
+    static const char* const types[4] = {"uint8_t", "uint16_t", "uint32_t", "uint64_t"};
+    static const char* const ops[6] = {"==", "!=", "<", ">", "<=", ">="};
+    FILE* f = fopen(path.c_str(), "w");
+    if (f == nullptr) return false;
+    if (strict) fprintf(f, "#define SERIALNUMBER_STRICT\n");
+    fprintf(f, "#include <stdint.h>\n");
+    if (serial) fprintf(f, "#include \"SerialNumber.h\"\n");
+    for (unsigned i=0; i<N; i++) {
+        const char* t = types[i % 4];
+        if (serial) {
+            fprintf(f, "int f%u(SerialNumber<%s> a, SerialNumber<%s> b, %s c) {\n    return 0", i, t, t, t);
+        }
+        else {
+            fprintf(f, "int f%u(%s a, %s b, %s c) {\n    return 0", i, t, t, t);
+        }
+        for (unsigned k=0; k<6; k++) {
+            fprintf(f, " + (a %s b) + (a %s c) + (c %s b)", ops[k], ops[k], ops[k]);
+        }
+        fprintf(f, ";\n}\n");
+    }
+    return fclose(f) == 0;
+}
+
+// best compile time of a translation unit in milliseconds, negative on error
+static double compile(const std::string& cxx, const std::string& src, const std::string& tmp, const std::string& path) {
+    const std::string cmd = cxx + " -std=gnu++11 -O0 -c -I\"" + src + "\" \"" + path + "\" -o \"" + tmp + "/compile_bench.o\"";
+    double best = -1;
+    for (unsigned r=0; r<COMPILES; r++) {
+        const double start = bench_now();
+        if (system(cmd.c_str()) != 0) return -1;
+        const double t = (bench_now() - start) / 1e6;
+        if ((best < 0) || (t < best)) best = t;
+    }
+    return best;
+}
+
+int main() {
+    const std::string cxx = env("CXX", "c++");
+    const std::string src = env("BENCH_SRC", "src");
+    const std::string tmp = env("BENCH_TMP", ".");
+    struct {
+        const char* name;
+        bool serial;
+        bool strict;
+        unsigned functions;
+    } const cases[4] = {
+        {"plain",     false, false, N},
+        {"include",   true,  false, 0},
+        {"operators", true,  false, N},
+        {"strict",    true,  true,  N}
+    };
+    double plain = 0;
+    for (unsigned c=0; c<4; c++) {
+        const std::string path = tmp + "/compile_bench_" + cases[c].name + ".cpp";
+        bool ok;
+        if (cases[c].functions == 0) {
+            FILE* f = fopen(path.c_str(), "w");
+            ok = (f != nullptr) && (fprintf(f, "#include \"SerialNumber.h\"\n") > 0) && (fclose(f) == 0);
+        }
+        else {
+            ok = generate(path, cases[c].serial, cases[c].strict);
+        }
+        const double t = ok ? compile(cxx, src, tmp, path) : -1;
+        if (t < 0) {
+            printf("ERROR: cannot compile %s\n", path.c_str());
+            return 1;
+        }
+        if (c == 0) plain = t;
+        printf("%-16s %-40s %10.1f ms/TU", "compile time", cases[c].name, t);
+        if (cases[c].serial && (cases[c].functions > 0)) {
+            printf("  (%+.1f us per comparison vs plain)", (t - plain) * 1000.0 / (18.0 * cases[c].functions));
+        }
+        printf("\n");
+        fflush(stdout);
+    }
+    return 0;
+}
@@ -0,0 +1,83 @@
+/*
+Benchmark of iterating over a wrapped range of SerialNumber<uint32_t>:
+a hand-written loop with operator++ and !=, a range-based for loop over
+serial_range(), std::for_each and, with C++17 and a parallel backend
+(TBB for libstdc++), std::for_each with std::execution::par.
+
+Every variant computes the same per-element work (a hash of the
+SerialNumber) into an output array, and the checksums must agree.
+*/
+
+#include <stdint.h>
+#include <stddef.h>
+#include <algorithm>
+#include <vector>
+#if (__cplusplus >= 201703L) && !defined(BENCH_NO_PARALLEL)
+#include <execution>
+#endif
+#include "bench_common.h"
+#include "SerialNumberRange.h"
+
+static const uint32_t FIRST = 0xFFF00000u;    // wraps after 2^20 elements
+static const uint32_t COUNT = 1u << 22;
+
+// some work per element, so there is something to parallelize
+static inline uint64_t work(uint32_t v) {
+    uint64_t h = v;
+    for (unsigned k=0; k<8; k++) {
+        h ^= h >> 33;
+        h *= 0xFF51AFD7ED558CCDull;
+    }
+    return h;
+}
+
+static std::vector<uint64_t> out(COUNT);
+
+static uint64_t checksum(void) {
+    uint64_t c = 0;
+    for (uint32_t i=0; i<COUNT; i++) c += out[i] * (i + 1);
+    return c;
+}
+
+int main() {
+    const SerialNumber<uint32_t> first{FIRST};
+    const SerialNumber<uint32_t> last{static_cast<uint32_t>(FIRST + COUNT)};
+    uint64_t expected;
+    int failed = 0;
+
+    bench_run("serial_range", "manual loop", COUNT, [&] {
+        for (SerialNumber<uint32_t> sn = first; sn != last; ++sn) {
+            out[static_cast<uint32_t>(sn.value() - FIRST)] = work(sn.value());
+        }
+        return out[COUNT - 1];
+    });
+    expected = checksum();
+    bench_run("serial_range", "range-based for", COUNT, [&] {
+        for (SerialNumber<uint32_t> sn : serial_range(first, last)) {
+            out[static_cast<uint32_t>(sn.value() - FIRST)] = work(sn.value());
+        }
+        return out[COUNT - 1];
+    });
+    if (checksum() != expected) failed = 1;
+    const SerialNumberRange<uint32_t> range = serial_range(first, last);
+    bench_run("serial_range", "std::for_each", COUNT, [&] {
+        std::for_each(range.begin(), range.end(), [](SerialNumber<uint32_t> sn) {
+            out[static_cast<uint32_t>(sn.value() - FIRST)] = work(sn.value());
+        });
+        return out[COUNT - 1];
+    });
+    if (checksum() != expected) failed = 1;
+#if defined(__cpp_lib_execution) && !defined(BENCH_NO_PARALLEL)
+    bench_run("serial_range", "std::for_each(par)", COUNT, [&] {
+        std::for_each(std::execution::par, range.begin(), range.end(), [](SerialNumber<uint32_t> sn) {
+            out[static_cast<uint32_t>(sn.value() - FIRST)] = work(sn.value());
+        });
+        return out[COUNT - 1];
+    });
+    if (checksum() != expected) failed = 1;
+#else
+    printf("%-16s %-40s not available\n", "serial_range", "std::for_each(par)");
+#endif
+    if (failed) printf("ERROR: checksums differ\n");
+    return failed;
+}
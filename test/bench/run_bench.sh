@@ -0,0 +1,69 @@
+#!/bin/sh
+#
+# Host benchmarks, built with optimization and without sanitizers.
+#
+# Each driver prints one line per measurement (nanoseconds per operation,
+# best of a few repetitions). The numbers depend on the host and are only
+# meaningful relative to each other. A driver exits with a non-zero status
+# if it detects an error, e.g. diverging results of two variants.
+#
+# stats_bench_on is stats_bench built with SERIALNUMBER_INSTRUMENTATION.
+#
+# Usage: test/bench/run_bench.sh [driver ...]   (CXX selects the compiler, default c++)
+
+CXX=${CXX:-c++}
+DIR=$(cd "$(dirname "$0")" && pwd)
+SRC="$DIR/../../src"
+OUT=$(mktemp -d)
+trap 'rm -rf "$OUT"' EXIT
+
+# compile_bench runs the compiler itself
+export CXX
+export BENCH_SRC="$SRC"
+export BENCH_TMP="$OUT"
+
+DRIVERS=${*:-"table_bench range_bench compile_bench stats_bench stats_bench_on vv_bench window_bench atomic_bench"}
+failed=0
+
+# parallel algorithms of libstdc++ need TBB, without it range_bench skips them
+echo 'int main() { return 0; }' > "$OUT/probe.cpp"
+if $CXX "$OUT/probe.cpp" -ltbb -o "$OUT/probe" > /dev/null 2>&1; then
+    TBB=-ltbb
+else
+    NO_TBB=-DBENCH_NO_PARALLEL
+fi
+
+# source file, compiler flags and libraries of a driver
+source_of() {
+    case "$1" in
+        stats_bench_on) echo stats_bench ;;
+        *) echo "$1" ;;
+    esac
+}
+flags_of() {
+    case "$1" in
+        range_bench) echo -std=gnu++17 $NO_TBB ;;
+        stats_bench_on) echo -std=gnu++11 -DSERIALNUMBER_INSTRUMENTATION ;;
+        *) echo -std=gnu++11 ;;
+    esac
+}
+libs_of() {
+    case "$1" in
+        range_bench) echo $TBB ;;
+    esac
+}
+
+for d in $DRIVERS; do
+    echo "== $d"
+    if ! $CXX $(flags_of "$d") -O2 -pthread -I"$SRC" -I"$DIR" "$DIR/$(source_of "$d").cpp" $(libs_of "$d") -o "$OUT/$d"; then
+        echo "FAIL: $d does not compile"
+        failed=1
+        continue
+    fi
+    if ! "$OUT/$d"; then
+        echo "FAIL: $d"
+        failed=1
+    fi
+done
+
+exit $failed
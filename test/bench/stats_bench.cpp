@@ -0,0 +1,83 @@
+/*
+Benchmark of the instrumentation hooks (see SerialNumberStats.h).
+
+run_bench.sh builds this driver twice: stats_bench without and
+stats_bench_on with SERIALNUMBER_INSTRUMENTATION. Both measure the
+comparison operators and operator++ of SerialNumber<uint32_t>. Without
+instrumentation, the operators must be as fast as the same comparisons
+written by hand on plain integers (zero overhead). With instrumentation,
+the overhead is a few thread-local counter updates per operation, and
+the driver checks the counters.
+*/
+
+#include <stdint.h>
+#include <stddef.h>
+#include <vector>
+#include "bench_common.h"
+#include "SerialNumber.h"
+
+#ifdef SERIALNUMBER_INSTRUMENTATION
+#define VARIANT(s) s ", instrumented"
+#else
+#define VARIANT(s) s
+#endif
+
+static const size_t PAIRS = 1 << 16;
+static const unsigned ROUNDS = 64;
+
+int main() {
+    std::vector<uint32_t> a(PAIRS), b(PAIRS);
+    std::vector<SerialNumber<uint32_t> > sa(PAIRS), sb(PAIRS);
+    BenchRandom rnd;
+    for (size_t i=0; i<PAIRS; i++) {
+        const uint64_t r = rnd.next();
+        a[i] = static_cast<uint32_t>(r);
+        // mostly close to a[i], like sequence numbers of a stream
+        b[i] = static_cast<uint32_t>(a[i] + static_cast<uint32_t>((r >> 32) % 2048) - 1024);
+        sa[i] = a[i];
+        sb[i] = b[i];
+    }
+    const uint64_t ops = 2ull * PAIRS * ROUNDS;
+    const uint64_t increments = 1ull << 24;
+
+    bench_run("instrumentation", "plain integers, < and >", ops, [&a, &b] {
+        uint64_t c = 0;
+        for (unsigned r=0; r<ROUNDS; r++) {
+            for (size_t i=0; i<PAIRS; i++) {
+                const uint32_t d = b[i] - a[i];
+                c += (d != 0) && (d < 0x80000000u);
+                c += d > 0x80000000u;
+            }
+        }
+        return c;
+    });
+    bench_run("instrumentation", VARIANT("operator< and operator>"), ops, [&sa, &sb] {
+        uint64_t c = 0;
+        for (unsigned r=0; r<ROUNDS; r++) {
+            for (size_t i=0; i<PAIRS; i++) {
+                c += sa[i] < sb[i];
+                c += sa[i] > sb[i];
+            }
+        }
+        return c;
+    });
+    bench_run("instrumentation", VARIANT("operator++"), increments, [increments] {
+        SerialNumber<uint16_t> sn{0};
+        uint64_t c = 0;
+        for (uint64_t i=0; i<increments; i++) {
+            ++sn;
+            c += sn.value();
+        }
+        return c;
+    });
+
+#ifdef SERIALNUMBER_INSTRUMENTATION
+    const SerialNumberCounters c32 = SerialNumberStats<uint32_t>::get();
+    const SerialNumberCounters c16 = SerialNumberStats<uint16_t>::get();
+    if ((c32.comparisons != ops * BENCH_REPEAT) || (c16.wraps != (increments >> 16) * BENCH_REPEAT)) {
+        printf("ERROR: counters %lu comparisons, %lu wraps\n", c32.comparisons, c16.wraps);
+        return 1;
+    }
+#endif
+    return 0;
+}
@@ -0,0 +1,76 @@
+/*
+Benchmark of the comparison kernels for SerialNumber<uint8_t>: arithmetic
+(serialnumber_less/greater) versus lookup tables (serialnumber_less_table/
+greater_table).
+
+Two access patterns are measured: all 256 x 256 pairs in order, and
+pseudo-random pairs, where the outcome of each comparison is
+unpredictable. See examples/SerialNumber_table_benchmark for the same
+comparison on an Arduino.
+*/
+
+#include <stdint.h>
+#include <stddef.h>
+#include <vector>
+#include "bench_common.h"
+#include "SerialNumber.h"
+
+static const size_t PAIRS = 1 << 16;
+static const unsigned ROUNDS = 64;
+
+int main() {
+    std::vector<uint8_t> a(PAIRS), b(PAIRS);
+    BenchRandom rnd;
+    for (size_t i=0; i<PAIRS; i++) {
+        const uint64_t r = rnd.next();
+        a[i] = static_cast<uint8_t>(r);
+        b[i] = static_cast<uint8_t>(r >> 8);
+    }
+    const uint64_t ops = 2ull * PAIRS * ROUNDS;
+
+    bench_run("uint8 kernels", "arithmetic, all pairs", ops, [] {
+        uint64_t c = 0;
+        for (unsigned r=0; r<ROUNDS; r++) {
+            for (unsigned i=0; i<256; i++) {
+                for (unsigned j=0; j<256; j++) {
+                    c += serialnumber_less<uint8_t>(static_cast<uint8_t>(i + r), static_cast<uint8_t>(j));
+                    c += serialnumber_greater<uint8_t>(static_cast<uint8_t>(i + r), static_cast<uint8_t>(j));
+                }
+            }
+        }
+        return c;
+    });
+    bench_run("uint8 kernels", "table, all pairs", ops, [] {
+        uint64_t c = 0;
+        for (unsigned r=0; r<ROUNDS; r++) {
+            for (unsigned i=0; i<256; i++) {
+                for (unsigned j=0; j<256; j++) {
+                    c += serialnumber_less_table(static_cast<uint8_t>(i + r), static_cast<uint8_t>(j));
+                    c += serialnumber_greater_table(static_cast<uint8_t>(i + r), static_cast<uint8_t>(j));
+                }
+            }
+        }
+        return c;
+    });
+    bench_run("uint8 kernels", "arithmetic, random pairs", ops, [&a, &b] {
+        uint64_t c = 0;
+        for (unsigned r=0; r<ROUNDS; r++) {
+            for (size_t i=0; i<PAIRS; i++) {
+                c += serialnumber_less<uint8_t>(a[i], b[i]);
+                c += serialnumber_greater<uint8_t>(a[i], b[i]);
+            }
+        }
+        return c;
+    });
+    bench_run("uint8 kernels", "table, random pairs", ops, [&a, &b] {
+        uint64_t c = 0;
+        for (unsigned r=0; r<ROUNDS; r++) {
+            for (size_t i=0; i<PAIRS; i++) {
+                c += serialnumber_less_table(a[i], b[i]);
+                c += serialnumber_greater_table(a[i], b[i]);
+            }
+        }
+        return c;
+    });
+    return 0;
+}
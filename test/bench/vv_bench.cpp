@@ -0,0 +1,67 @@
+/*
+Benchmark of merge() and compare() of SerialVersionVector<uint32_t, N> and
+SparseSerialVersionVector<uint32_t, N> for N = 8, 64 and 1024.
+
+A pool of vectors holds entries close to a common base, which is near the
+wrap-around point of uint32_t, so the results of compare() vary. The
+sparse vectors hold every second node id, so merge() has to combine
+one-sided entries. The time is given per call and per entry.
+*/
+
+#include <stdint.h>
+#include <stddef.h>
+#include <vector>
+#include "bench_common.h"
+#include "SerialVersionVector.h"
+
+static const size_t POOL = 64;
+static const uint64_t ENTRIES = 1ull << 24; // per measurement
+static const uint32_t BASE = 0xFFFFFF00u;
+
+template <class V>
+static void measure(const char* name, const std::vector<V>& pool, size_t n) {
+    const uint64_t calls = ENTRIES / n;
+    char variant[64];
+
+    snprintf(variant, sizeof(variant), "N=%zu compare", n);
+    bench_run(name, variant, calls * n, [&pool, calls] {
+        uint64_t c = 0;
+        for (uint64_t i=0; i<calls; i++) {
+            c += static_cast<uint64_t>(pool[i % POOL].compare(pool[(i * 7 + 1) % POOL]));
+        }
+        return c;
+    });
+    snprintf(variant, sizeof(variant), "N=%zu merge", n);
+    bench_run(name, variant, calls * n, [&pool, calls, n] {
+        V acc = pool[0];
+        for (uint64_t i=0; i<calls; i++) {
+            acc.merge(pool[i % POOL]);
+        }
+        uint64_t c = 0;
+        for (size_t k=0; k<n; k++) c += acc.get(static_cast<uint16_t>(k)).value();
+        return c;
+    });
+}
+
+template <size_t N>
+static void run(void) {
+    BenchRandom rnd(N);
+    std::vector<SerialVersionVector<uint32_t, N> > dense(POOL);
+    std::vector<SparseSerialVersionVector<uint32_t, N> > sparse(POOL);
+    for (size_t k=0; k<POOL; k++) {
+        for (size_t i=0; i<N; i++) {
+            const uint32_t v = static_cast<uint32_t>(BASE + rnd.next() % 512);
+            dense[k].set(i, v);
+            if (i < N / 2) sparse[k].set(static_cast<uint16_t>(2 * i + ((k >> 1) & 1)), v);
+        }
+    }
+    measure("dense vector", dense, N);
+    measure("sparse vector", sparse, N);
+}
+
+int main() {
+    run<8>();
+    run<64>();
+    run<1024>();
+    return 0;
+}
@@ -0,0 +1,90 @@
+/*
+Benchmark of the per-update cost of SerialWindowAggregator<uint32_t,
+SerialWindowMax<uint32_t>, W> for W = 16, 256, 4096 and 65536.
+
+Each update adds a value and reads the aggregate. The window is filled
+before measuring. Three streams of SerialNumbers are measured, all
+starting close to the wrap-around point of uint32_t:
+
+ - in order:     consecutive SerialNumbers
+ - gaps:         SerialNumbers advancing by 1 ... 4
+ - late 1/8:     in order, but every 8th update is a late arrival with an
+                 age drawn uniformly from 1 ... W-1
+
+In order, an update takes O(1) amortized time, independent of W. A late
+arrival in the front part costs time proportional to W minus its age, so
+the stream with late arrivals is shortened for large W.
+*/
+
+#include <stdint.h>
+#include <stddef.h>
+#include <vector>
+#include "bench_common.h"
+#include "SerialWindowAggregator.h"
+
+static const size_t UPDATES = 1 << 22;
+static const uint32_t FIRST = 0xFFFF0000u;
+
+// SerialNumbers of a stream, as offsets from the highest SerialNumber
+// before the stream, which advances by span
+static std::vector<uint32_t> stream(unsigned kind, size_t w, uint32_t& span) {
+    size_t n = UPDATES;
+    if ((kind == 2) && (w > 256)) {
+        // at least 4 * w, so the front part is rebuilt a few times
+        n = (UPDATES / (w / 256) > 4 * w) ? UPDATES / (w / 256) : 4 * w;
+    }
+    std::vector<uint32_t> s(n);
+    BenchRandom rnd(kind + 1);
+    uint32_t hi = 0;
+    for (size_t i=0; i<n; i++) {
+        const uint64_t r = rnd.next();
+        if ((kind == 2) && (i % 8 == 7)) {
+            s[i] = hi - static_cast<uint32_t>(1 + (r >> 8) % (w - 1));
+        }
+        else {
+            hi += (kind == 1) ? static_cast<uint32_t>(1 + (r & 3)) : 1;
+            s[i] = hi;
+        }
+    }
+    span = hi;
+    return s;
+}
+
+template <size_t W>
+static void run(void) {
+    typedef SerialWindowAggregator<uint32_t, SerialWindowMax<uint32_t>, W> Aggregator;
+    static const char* const kinds[3] = {"in order", "gaps", "late 1/8"};
+    // too large for the stack with W = 65536
+    Aggregator* agg = new Aggregator;
+    for (unsigned k=0; k<3; k++) {
+        uint32_t span;
+        const std::vector<uint32_t> s = stream(k, W, span);
+        // fill the window, so late arrivals are within the window from the start
+        uint32_t base = FIRST;
+        agg->reset();
+        for (size_t i=0; i<W; i++) {
+            agg->add(SerialNumber<uint32_t>{++base}, 1);
+        }
+        char variant[64];
+        snprintf(variant, sizeof(variant), "W=%zu %s", W, kinds[k]);
+        bench_run("window", variant, s.size(), [agg, &s, &base, span] {
+            uint64_t c = 0;
+            for (size_t i=0; i<s.size(); i++) {
+                const uint32_t sn = static_cast<uint32_t>(base + s[i]);
+                agg->add(SerialNumber<uint32_t>{sn}, static_cast<uint32_t>(sn * 2654435761u));
+                c += agg->aggregate();
+            }
+            base = static_cast<uint32_t>(base + span);
+            return c;
+        });
+    }
+    delete agg;
+}
+
+int main() {
+    run<16>();
+    run<256>();
+    run<4096>();
+    run<65536>();
+    return 0;
+}
@@ -0,0 +1,70 @@
+/*
+Stress test for SerialNumberQueue (multiple producers, multiple consumers).
+
+Each producer pushes its own numbers p * ITEMS ... p * ITEMS + ITEMS - 1 in 
+order. Consumers pop items in batches of varying size. Each consumer 
+checks that the items of every producer arrive in increasing order 
+(the queue is FIFO), and at the end every item must have been received 
+exactly once. The cursors and tickets are SerialNumber<uint16_t>, so they 
+wrap around many times during the run.
+
+Build and run with ThreadSanitizer, see run_stress.sh.
+*/
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include "SerialNumberQueue.h"
+
+static const unsigned PRODUCERS = 4;
+static const unsigned CONSUMERS = 4;
+static const uint64_t ITEMS = 100000; // per producer
+static SerialNumberQueue<uint64_t, 256, uint16_t> queue;
+static std::atomic<uint8_t> seen[PRODUCERS * ITEMS];
+
+int main() {
+    std::atomic<uint64_t> received{0};
+    std::atomic<unsigned long> errors{0};
+    std::vector<std::thread> threads;
+
+    for (unsigned p=0; p<PRODUCERS; p++) {
+        threads.emplace_back([p] {
+            for (uint64_t i=0; i<ITEMS; i++) {
+                while (!queue.push(p * ITEMS + i)) std::this_thread::yield();
+            }
+        });
+    }
+
+    for (unsigned c=0; c<CONSUMERS; c++) {
+        threads.emplace_back([c, &received, &errors] {
+            uint64_t last[PRODUCERS];
+            bool started[PRODUCERS] = {};
+            uint64_t items[8];
+            size_t batch = 1 + c;
+            while (received.load() < PRODUCERS * ITEMS) {
+                const size_t n = queue.pop(items, batch);
+                for (size_t i=0; i<n; i++) {
+                    const uint64_t v = items[i];
+                    const unsigned p = static_cast<unsigned>(v / ITEMS);
+                    if (started[p] && (v <= last[p])) errors++;
+                    started[p] = true;
+                    last[p] = v;
+                    seen[v]++;
+                }
+                received += n;
+                batch = 1 + (batch % 8);
+            }
+        });
+    }
+
+    for (size_t t=0; t<threads.size(); t++) threads[t].join();
+
+    for (uint64_t v=0; v<PRODUCERS * ITEMS; v++) {
+        if (seen[v].load() != 1) errors++;
+    }
+    printf("queue_stress: %llu items, %lu errors\n", static_cast<unsigned long long>(PRODUCERS * ITEMS), errors.load());
+    return (errors.load() == 0) ? 0 : 1;
+}
@@ -0,0 +1,52 @@
+/*
+Stress test for SerialNumberRing (single producer, single consumer).
+
+The producer pushes the numbers 0 ... ITEMS-1 in batches of varying size,
+the consumer pops them in batches and checks that they arrive complete
+and in order. The cursors are SerialNumber<uint16_t>, so they wrap around
+many times during the run.
+
+Build and run with ThreadSanitizer, see run_stress.sh.
+*/
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <thread>
+#include "SerialNumberRing.h"
+
+static const uint64_t ITEMS = 1000000;
+static SerialNumberRing<uint64_t, 1024, uint16_t> ring;
+
+int main() {
+    std::thread producer([] {
+        uint64_t next = 0;
+        uint64_t batch[7];
+        while (next < ITEMS) {
+            // batches of 1 ... 7 items, single pushes in between
+            const size_t n = 1 + static_cast<size_t>(next % 7);
+            size_t k = 0;
+            while ((k < n) && (next + k < ITEMS)) {
+                batch[k] = next + k;
+                k++;
+            }
+            if (k == 1) next += ring.push(batch[0]) ? 1 : 0;
+            else next += ring.push(batch, k);
+        }
+    });
+
+    uint64_t expected = 0;
+    unsigned long errors = 0;
+    uint64_t items[16];
+    while (expected < ITEMS) {
+        const size_t n = ring.pop(items, 1 + static_cast<size_t>(expected % 16));
+        for (size_t i=0; i<n; i++) {
+            if (items[i] != expected) errors++;
+            expected++;
+        }
+    }
+    producer.join();
+
+    printf("ring_stress: %llu items, %lu errors\n", static_cast<unsigned long long>(ITEMS), errors);
+    return (errors == 0) ? 0 : 1;
+}
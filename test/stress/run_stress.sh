@@ -0,0 +1,49 @@
+#!/bin/sh
+#
+# Stress tests for the lock-free classes, built with ThreadSanitizer.
+#
+# Each driver exits with a non-zero status if it detects an error, and
+# ThreadSanitizer aborts the run if it detects a data race. Every driver is
+# also run as an optimized build without sanitizer, which is much faster 
+# and thus exercises more interleavings.
+#
+# Note that ThreadSanitizer does not model std::atomic_thread_fence (GCC 
+# warns about this for SerialSeqLock). For SerialSeqLock, the consistency
+# checks of the readers in seqlock_stress.cpp are the relevant test.
+#
+# Usage: test/stress/run_stress.sh [driver ...]   (CXX selects the compiler, default c++)
+
+CXX=${CXX:-c++}
+DIR=$(cd "$(dirname "$0")" && pwd)
+SRC="$DIR/../../src"
+OUT=$(mktemp -d)
+trap 'rm -rf "$OUT"' EXIT
+
+DRIVERS=${*:-"ring_stress queue_stress seqlock_stress"}
+failed=0
+
+for d in $DRIVERS; do
+    echo "== $d (ThreadSanitizer)"
+    if ! $CXX -std=gnu++11 -O1 -g -fsanitize=thread -pthread -I"$SRC" "$DIR/$d.cpp" -o "$OUT/$d-tsan"; then
+        echo "FAIL: $d does not compile"
+        failed=1
+        continue
+    fi
+    if ! TSAN_OPTIONS="halt_on_error=1 ${TSAN_OPTIONS:-}" "$OUT/$d-tsan"; then
+        echo "FAIL: $d (ThreadSanitizer)"
+        failed=1
+    fi
+
+    echo "== $d (optimized)"
+    if ! $CXX -std=gnu++11 -O2 -pthread -I"$SRC" "$DIR/$d.cpp" -o "$OUT/$d"; then
+        echo "FAIL: $d does not compile"
+        failed=1
+        continue
+    fi
+    if ! "$OUT/$d"; then
+        echo "FAIL: $d (optimized)"
+        failed=1
+    fi
+done
+
+exit $failed
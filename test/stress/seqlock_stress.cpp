@@ -0,0 +1,69 @@
+/*
+Stress test for SerialSeqLock (one writer, several readers).
+
+The writer publishes payloads whose fields are fixed multiples of a 
+counter. Readers check every copy they get for consistency, so a torn 
+read (a copy mixing two versions) is detected. Version numbers are 
+SerialNumber<uint16_t>, so they wrap around many times during the run.
+The test runs with a single slot and with several slots.
+
+Build and run with and without ThreadSanitizer, see run_stress.sh.
+*/
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include "SerialSeqLock.h"
+
+struct Payload {
+    uint64_t a, b, c, d;
+};
+
+static const unsigned READERS = 3;
+static const uint64_t VERSIONS = 300000;   // at least
+static const unsigned long READS = 100000; // at least
+
+template <size_t N>
+static unsigned long run(void) {
+    static SerialSeqLock<uint16_t, Payload, N> lock{Payload{0, 0, 0, 0}};
+    std::atomic<bool> stop{false};
+    std::atomic<unsigned long> errors{0};
+    std::atomic<unsigned long> reads{0};
+    std::vector<std::thread> readers;
+
+    for (unsigned r=0; r<READERS; r++) {
+        readers.emplace_back([&stop, &errors, &reads] {
+            uint64_t last = 0;
+            while (!stop.load()) {
+                Payload p;
+                lock.read(p);
+                if ((p.b != 2 * p.a) || (p.c != 3 * p.a) || (p.d != 4 * p.a)) errors++;
+                // versions seen by one reader never go back
+                if (p.a < last) errors++;
+                last = p.a;
+                reads++;
+            }
+        });
+    }
+
+    // keep writing until the readers had a fair chance to interfere
+    uint64_t written = 0;
+    while ((written < VERSIONS) || (reads.load() < READS)) {
+        written++;
+        lock.write(Payload{written, 2 * written, 3 * written, 4 * written});
+    }
+    stop = true;
+    for (size_t t=0; t<readers.size(); t++) readers[t].join();
+
+    printf("seqlock_stress N=%u: %llu versions, %lu reads, %lu errors\n", static_cast<unsigned>(N),
+        static_cast<unsigned long long>(written), reads.load(), errors.load());
+    return errors.load();
+}
+
+int main() {
+    const unsigned long errors = run<1>() + run<4>();
+    return (errors == 0) ? 0 : 1;
+}
@@ -0,0 +1,55 @@
+#!/bin/sh
+#
+# Negative compile checks for SERIALNUMBER_STRICT.
+#
+# Compiles strict_cases.cpp once per case: CASE_OK must compile, all other
+# cases compare a SerialNumber<uint16_t> to a plain number of another type 
+# and must be rejected by the compiler. A rejection only counts if every 
+# error is about the deleted comparison operator of the case (GCC: "use of
+# deleted function ... operator==", Clang: "... deleted operator '=='"), so
+# that typos or missing includes do not pass as strict mode at work.
+#
+# Usage: test/strict/check_strict.sh   (CXX selects the compiler, default c++)
+
+CXX=${CXX:-c++}
+DIR=$(cd "$(dirname "$0")" && pwd)
+SRC="$DIR/../../src"
+OUT=$(mktemp -d)
+trap 'rm -rf "$OUT"' EXIT
+
+failed=0
+
+compile() {
+    $CXX -std=gnu++11 -Wall -I"$SRC" -D"$1" -c "$DIR/strict_cases.cpp" -o "$OUT/$1.o" > "$OUT/$1.log" 2>&1
+}
+
+if compile CASE_OK; then
+    echo "ok:   CASE_OK compiles"
+else
+    echo "FAIL: CASE_OK does not compile"
+    cat "$OUT/CASE_OK.log"
+    failed=1
+fi
+
+# case and the operator it uses
+for entry in CASE_INT:== CASE_INT_REVERSED:'<' CASE_UNSIGNED:'>' CASE_DOUBLE:'<=' \
+             CASE_UINT32:'!=' CASE_UINT32_REVERSED:'>='; do
+    c=${entry%%:*}
+    op=${entry#*:}
+    if compile "$c"; then
+        echo "FAIL: $c compiles, but must be rejected"
+        failed=1
+        continue
+    fi
+    errors=$(grep -c 'error:' "$OUT/$c.log")
+    expected=$(grep 'error:' "$OUT/$c.log" | grep 'deleted' | grep -c -e "operator$op(" -e "operator '$op'")
+    if [ "$errors" -gt 0 ] && [ "$errors" -eq "$expected" ]; then
+        echo "ok:   $c is rejected (deleted operator$op)"
+    else
+        echo "FAIL: $c is rejected for another reason than the deleted operator$op"
+        cat "$OUT/$c.log"
+        failed=1
+    fi
+done
+
+exit $failed
@@ -0,0 +1,41 @@
+/*
+Compile checks for SERIALNUMBER_STRICT, see check_strict.sh.
+
+Exactly one of the CASE_* macros is defined per compiler run. CASE_OK 
+must compile, all other cases must fail to compile.
+*/
+
+#define SERIALNUMBER_STRICT
+#include <stdint.h>
+#include <stddef.h>
+#include "SerialNumber.h"
+
+int main() {
+    SerialNumber<uint16_t> sn{65000};
+    bool r = false;
+#if defined(CASE_OK)
+    // same type: SerialNumber and plain uint16_t, both operand orders
+    uint16_t c16 = 17000;
+    SerialNumber<uint16_t> other{17000};
+    r = (sn == other) || (sn < other) || (sn >= other);
+    r = r || (sn == c16) || (c16 != sn) || (sn < c16) || (c16 > sn);
+    r = r || (sn <= static_cast<uint16_t>(17000u)) || (sn >= static_cast<uint16_t>(17000u));
+#elif defined(CASE_INT)
+    r = (sn == 17000);
+#elif defined(CASE_INT_REVERSED)
+    r = (17000 < sn);
+#elif defined(CASE_UNSIGNED)
+    r = (sn > 17000u);
+#elif defined(CASE_DOUBLE)
+    r = (sn <= 17000.0);
+#elif defined(CASE_UINT32)
+    uint32_t c32 = 17000;
+    r = (sn != c32);
+#elif defined(CASE_UINT32_REVERSED)
+    uint32_t c32 = 17000;
+    r = (c32 >= sn);
+#else
+#error "no CASE_* macro defined"
+#endif
+    return r ? 0 : 1;
+}